@@ -10,6 +10,8 @@
  */
 
 #include "Appetizer.hpp"
+#include "DishParser.hpp"
+#include "EnumTables.hpp"
 #include <iomanip> // For std::fixed and std::setprecision
 #include <vector>
 
@@ -40,6 +42,7 @@ Appetizer::Appetizer(const std::string& name, const std::vector<std::string>& in
  * @post Sets the private member `serving_style_` to the value of the parameter.
  */
 void Appetizer::setServingStyle(const ServingStyle &serving_style) {
+    invalidateViews();
     serving_style_ = serving_style;
 }
 
@@ -56,6 +59,7 @@ Appetizer::ServingStyle Appetizer::getServingStyle() const {
  * @post Sets the private member `spiciness_level_` to the value of the parameter.
  */
 void Appetizer::setSpicinessLevel(const int &spiciness_level) {
+    invalidateViews();
     spiciness_level_ = spiciness_level;
 }
 
@@ -72,6 +76,7 @@ int Appetizer::getSpicinessLevel() const {
  * @post Sets the private member `vegetarian_` to the value of the parameter.
  */
 void Appetizer::setVegetarian(const bool &vegetarian) {
+    invalidateViews();
     vegetarian_ = vegetarian;
 }
 
@@ -104,10 +109,10 @@ void Appetizer::display() const{
     //std::cout << "CALLED APPETIZER DISPLAY" << std::endl;
     std::cout << "Dish Name: " << getName() << std::endl;
     std::cout << "Ingredients: ";
-    //std::cout << "Ingrid Size: " << getIngredients().size() << std::endl;
-    for (size_t i = 0; i < getIngredients().size(); ++i) {
-        std::cout << getIngredients()[i];
-        if (i != getIngredients().size() - 1) {
+    //std::cout << "Ingrid Size: " << getIngredientCount() << std::endl;
+    for (size_t i = 0; i < getIngredientCount(); ++i) {
+        std::cout << getIngredient(i);
+        if (i != getIngredientCount() - 1) {
             std::cout << ", ";
         }
     }
@@ -115,19 +120,7 @@ void Appetizer::display() const{
     std::cout << "Preparation Time: " << getPrepTime() << " minutes" << std::endl;
     std::cout << std::fixed << std::setprecision(2) << "Price: $" << getPrice() << std::endl;
     std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
-    std::cout << "Serving Style: ";
-    switch (getServingStyle()) {
-        case ServingStyle::PLATED: 
-            std::cout << "Plated";
-            break;
-        case ServingStyle::FAMILY_STYLE: 
-            std::cout << "Family Style";
-            break;
-        case ServingStyle::BUFFET: 
-            std::cout << "Buffet";
-            break;
-    }
-    std::cout << std::endl;
+    std::cout << "Serving Style: " << enumLabel(SERVING_STYLE_TABLE, getServingStyle()) << std::endl;
     std::cout << "Spiciness Level: " << getSpicinessLevel() << std::endl;
     std::cout << "Vegetarian: ";
     if (isVegetarian()) std::cout << "Yes" ; else std::cout << "No"; // I did this just by going from the dome so check this if it doesnt display properly
@@ -159,29 +152,10 @@ without substitution.
 "Bread", "Pasta", "Barley", "Rye", "Oats", "Crust".
 */
 void Appetizer::dietaryAccommodations(const Dish::DietaryRequest request){
+    applyDietaryRules(DishRecord::APPETIZER, request);
+
     if(request.vegetarian){ // vegeterian condition
-        bool first = 1, second = 1;
-        std::string s;
-        std::vector<std::string> nonVeg = {"Meat", "Chicken", "Fish", "Beef", "Pork", "Lamb", "Shrimp", "Bacon"};
-        std::vector<std::string> ingrid = getIngredients();
         setVegetarian(request.vegetarian);
-        for (int i = 0; i < (int) ingrid.size(); ++i) {
-            for (auto &&j : nonVeg){
-                if(j == ingrid[i]){
-                    if(first){
-                        ingrid[i] = "Beans";
-                        first = false;
-                    } else if(second){
-                        ingrid[i] = "Mushrooms";
-                        second = false;
-                    } else {
-                        auto pos = ingrid.begin() + i; // check that this removes properly
-                        ingrid.erase(pos);
-                    }
-                }
-            }
-        }
-        setIngredients(ingrid);
     }
 
     if(request.low_sodium){ // low sodium
@@ -191,20 +165,20 @@ void Appetizer::dietaryAccommodations(const Dish::DietaryRequest request){
         }
         setSpicinessLevel(spice);
     }
+}
 
-    if(request.gluten_free){ // gluten free
-        std::string s;
-        std::vector<std::string> glut = {"Wheat", "Flour", "Bread", "Pasta", "Barley", "Rye", "Oats", "Crust"};
-        std::vector<std::string> ingrid = getIngredients();
-        for (int i = 0; i < (int) ingrid.size(); ++i) {
-            for (auto &&j : glut){
-                if(j == ingrid[i]){
-                    auto pos = ingrid.begin() + i; // check that this removes properly
-                    ingrid.erase(pos);
-                }
-            }
-            
-        }
-        setIngredients(ingrid);
+Appetizer* Appetizer::clone() const {
+    return new Appetizer(*this);
+}
+
+std::uint8_t Appetizer::dietaryProfile() const {
+    std::uint8_t profile = Dish::dietaryProfile();
+    if (!isVegetarian()) {
+        // The flag also covers meat the ingredient classes do not know, e.g. "Sausage Meat"
+        profile &= ~(VEGETARIAN | VEGAN);
     }
-}
\ No newline at end of file
+    if (getSpicinessLevel() > 0) {
+        profile &= ~LOW_SODIUM;
+    }
+    return profile;
+}
@@ -12,13 +12,14 @@
 #define APPETIZER_HPP
 
 #include "Dish.hpp"
+#include "ObjectPool.hpp"
 #include <string>
 
 /**
  * @class Appetizer
  * @brief Represents an appetizer dish, inheriting from Dish.
  */
-class Appetizer : public Dish {
+class Appetizer : public Dish, public PoolAllocated<Appetizer> {
 public:
     /**
      * @enum ServingStyle
@@ -126,6 +127,16 @@ public:
     */
    void dietaryAccommodations(const Dish::DietaryRequest request);
 
+    /**
+     * @return A new Appetizer with the same fields, allocated from pool().
+     */
+    Appetizer* clone() const override;
+
+    /**
+     * @return Dish::dietaryProfile(), where vegetarian and vegan also need the vegetarian flag, and
+     * low_sodium only holds if the spiciness level is already 0.
+     */
+    std::uint8_t dietaryProfile() const override;
 
 private:
     ServingStyle serving_style_; ///< The serving style of the appetizer.
@@ -107,6 +107,36 @@ bool ArrayBag<ItemType>::contains(const ItemType& an_entry) const
 	return getIndexOf(an_entry) > -1;
 }  // end contains
 
+/**
+ @return an iterator to the first item
+ **/
+template<class ItemType>
+typename ArrayBag<ItemType>::iterator ArrayBag<ItemType>::begin()
+{
+   return items_;
+}  // end begin
+
+template<class ItemType>
+typename ArrayBag<ItemType>::const_iterator ArrayBag<ItemType>::begin() const
+{
+   return items_;
+}  // end begin
+
+/**
+ @return an iterator one past the last live item
+ **/
+template<class ItemType>
+typename ArrayBag<ItemType>::iterator ArrayBag<ItemType>::end()
+{
+   return items_ + item_count_;
+}  // end end
+
+template<class ItemType>
+typename ArrayBag<ItemType>::const_iterator ArrayBag<ItemType>::end() const
+{
+   return items_ + item_count_;
+}  // end end
+
 // ********* PRIVATE METHODS **************//
 
 /**
@@ -14,6 +14,9 @@ class ArrayBag
 {
 
    public:
+   typedef ItemType *iterator;             // random-access iterator over the live items
+   typedef const ItemType *const_iterator;
+
    /** default constructor**/
    ArrayBag();
 
@@ -52,6 +55,18 @@ class ArrayBag
    **/
    int getFrequencyOf(const ItemType &an_entry) const;
 
+   /**
+       @return an iterator to the first item, for range-for loops and standard algorithms
+   **/
+   iterator begin();
+   const_iterator begin() const;
+
+   /**
+       @return an iterator one past the last live item (items_ + item_count_)
+   **/
+   iterator end();
+   const_iterator end() const;
+
    protected:
    static const int DEFAULT_CAPACITY = 100; //max size of items_ at 100 by default for this project
    ItemType items_[DEFAULT_CAPACITY];      // Array of bag items
@@ -0,0 +1,134 @@
+/**
+ * @file ConcurrentKitchen.cpp
+ * @brief This file contains the implementation of the ConcurrentKitchen class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "ConcurrentKitchen.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+static_assert(std::atomic<int>::is_always_lock_free, "report getters rely on lock-free atomics");
+
+ConcurrentKitchen::ConcurrentKitchen(unsigned stripes)
+    : stripe_mask_(0), dish_count_(0), total_prep_time_(0), count_elaborate_(0)
+{
+    if (stripes == 0)
+    {
+        stripes = 4 * std::max(1u, std::thread::hardware_concurrency());
+    }
+    unsigned count = 1;
+    while (count < stripes)
+    {
+        count *= 2;
+    }
+    stripes_.reset(new Stripe[count]);
+    stripe_mask_ = count - 1;
+}
+
+ConcurrentKitchen::~ConcurrentKitchen()
+{
+    for (unsigned s = 0; s <= stripe_mask_; s++)
+    {
+        for (Dish* dish : stripes_[s].dishes)
+        {
+            delete dish;
+        }
+    }
+}
+
+ConcurrentKitchen::Stripe& ConcurrentKitchen::stripeFor(const Dish* dish) const
+{
+    // The stripe bags place a key by bits 32 and up of (pointer * golden ratio), so the stripe must
+    // come from a mixer unrelated to that one; otherwise every key in a stripe shares the same
+    // slice of home slots in its bag and linear probing clusters. This is the SplitMix64 finalizer.
+    std::uint64_t mixed = reinterpret_cast<std::uintptr_t>(dish);
+    mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+    mixed ^= mixed >> 31;
+    return stripes_[mixed & stripe_mask_];
+}
+
+bool ConcurrentKitchen::newOrder(Dish* new_dish)
+{
+    Stripe& stripe = stripeFor(new_dish);
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        if (!stripe.dishes.add(new_dish))
+        {
+            return false;
+        }
+    }
+    dish_count_.fetch_add(1, std::memory_order_relaxed);
+    total_prep_time_.fetch_add(new_dish->getPrepTime(), std::memory_order_relaxed);
+    if (new_dish->isElaborate())
+    {
+        count_elaborate_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool ConcurrentKitchen::serveDish(Dish* dish_to_remove)
+{
+    Stripe& stripe = stripeFor(dish_to_remove);
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        if (!stripe.dishes.remove(dish_to_remove))
+        {
+            return false;
+        }
+    }
+    dish_count_.fetch_sub(1, std::memory_order_relaxed);
+    total_prep_time_.fetch_sub(dish_to_remove->getPrepTime(), std::memory_order_relaxed);
+    if (dish_to_remove->isElaborate())
+    {
+        count_elaborate_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool ConcurrentKitchen::contains(Dish* dish) const
+{
+    Stripe& stripe = stripeFor(dish);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    return stripe.dishes.contains(dish);
+}
+
+int ConcurrentKitchen::getCurrentSize() const
+{
+    return dish_count_.load(std::memory_order_relaxed);
+}
+
+int ConcurrentKitchen::getPrepTimeSum() const
+{
+    return total_prep_time_.load(std::memory_order_relaxed);
+}
+
+int ConcurrentKitchen::calculateAvgPrepTime() const
+{
+    int count = getCurrentSize();
+    if (count <= 0)
+    {
+        return 0;
+    }
+    return round(double(getPrepTimeSum()) / count);
+}
+
+int ConcurrentKitchen::elaborateDishCount() const
+{
+    return count_elaborate_.load(std::memory_order_relaxed);
+}
+
+double ConcurrentKitchen::calculateElaboratePercentage() const
+{
+    int count = getCurrentSize();
+    int elaborate = elaborateDishCount();
+    if (count <= 0 || elaborate <= 0)
+    {
+        return 0;
+    }
+    return round(double(elaborate) / double(count) * 10000) / 100;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file ConcurrentKitchen.hpp
+ * @brief This file contains the interface of the ConcurrentKitchen class, a kitchen that several
+ * threads can take orders into and serve from at the same time.
+ *
+ * Dishes are spread over lock-striped IndexedArrayBags by pointer hash, so orders on different
+ * stripes never contend, and the running totals are atomics that the report getters read without
+ * taking any lock.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef CONCURRENTKITCHEN_HPP
+#define CONCURRENTKITCHEN_HPP
+
+#include "IndexedArrayBag.hpp"
+#include "Dish.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+class ConcurrentKitchen {
+    public:
+        /**
+        * Parameterized constructor.
+        * @param stripes The number of independently locked bags, rounded up to a power of two.
+        * 0 picks four per hardware thread.
+        */
+        explicit ConcurrentKitchen(unsigned stripes = 0);
+
+        /**
+        * Destructor.
+        * @post Deallocates all dishes still in the kitchen.
+        */
+        ~ConcurrentKitchen();
+
+        ConcurrentKitchen(const ConcurrentKitchen&) = delete;
+        ConcurrentKitchen& operator=(const ConcurrentKitchen&) = delete;
+
+        /**
+        * Adds a dish. Safe to call from any number of threads.
+        * @param new_dish The dish to add. The kitchen takes ownership of it if it is added.
+        * @return True if the dish was added, false if it is already in the kitchen.
+        */
+        bool newOrder(Dish* new_dish);
+
+        /**
+        * Removes a dish. Safe to call from any number of threads.
+        * @param dish_to_remove The dish to remove. The caller takes ownership of it if it is removed.
+        * @return True if the dish was removed, false if it is not in the kitchen.
+        */
+        bool serveDish(Dish* dish_to_remove);
+
+        /**
+        * @return True if the dish is in the kitchen.
+        */
+        bool contains(Dish* dish) const;
+
+        // The getters below are wait-free: each is a single relaxed atomic load.
+        // Each value is exact on its own; values read one after another may straddle an update.
+        int getCurrentSize() const;
+        int getPrepTimeSum() const;
+        int calculateAvgPrepTime() const;
+        int elaborateDishCount() const;
+        double calculateElaboratePercentage() const;
+
+        /**
+        * Calls fn(Dish*) for every dish, holding one stripe's lock at a time.
+        * fn must not call back into this kitchen.
+        */
+        template <class Fn>
+        void forEach(Fn fn) const;
+
+    private:
+        struct alignas(64) Stripe {
+            mutable std::mutex mutex;
+            IndexedArrayBag<Dish*> dishes;
+        };
+
+        std::unique_ptr<Stripe[]> stripes_;
+        unsigned stripe_mask_;
+        std::atomic<int> dish_count_;
+        std::atomic<int> total_prep_time_;
+        std::atomic<int> count_elaborate_;
+
+        Stripe& stripeFor(const Dish* dish) const;
+};
+
+template <class Fn>
+void ConcurrentKitchen::forEach(Fn fn) const
+{
+    for (unsigned s = 0; s <= stripe_mask_; s++)
+    {
+        std::lock_guard<std::mutex> lock(stripes_[s].mutex);
+        for (Dish* dish : stripes_[s].dishes)
+        {
+            fn(dish);
+        }
+    }
+}
+
+#endif // CONCURRENTKITCHEN_HPP
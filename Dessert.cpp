@@ -10,6 +10,8 @@
  */
 
 #include "Dessert.hpp"
+#include "DishParser.hpp"
+#include "EnumTables.hpp"
 
 /**
  * Default constructor.
@@ -38,6 +40,7 @@ Dessert::Dessert(const std::string& name, const std::vector<std::string>& ingred
  * @post Sets the private member `flavor_profile_` to the value of the parameter.
  */
 void Dessert::setFlavorProfile(const FlavorProfile &flavor_profile) {
+    invalidateViews();
     flavor_profile_ = flavor_profile;
 }
 
@@ -54,6 +57,7 @@ Dessert::FlavorProfile Dessert::getFlavorProfile() const {
  * @post Sets the private member `sweetness_level_` to the value of the parameter.
  */
 void Dessert::setSweetnessLevel(const int &sweetness_level) {
+    invalidateViews();
     sweetness_level_ = sweetness_level;
 }
 
@@ -70,6 +74,7 @@ int Dessert::getSweetnessLevel() const {
  * @post Sets the private member `contains_nuts_` to the value of the parameter.
  */
 void Dessert::setContainsNuts(const bool &contains_nuts) {
+    invalidateViews();
     contains_nuts_ = contains_nuts;
 }
 
@@ -103,9 +108,9 @@ bool Dessert::containsNuts() const {
         //std::cout << "CALLED DESSERT DISPLAY" << std::endl;
         std::cout << "Dish Name: " << getName() << std::endl;
         std::cout << "Ingredients: ";
-        for (size_t i = 0; i < getIngredients().size(); ++i) {
-            std::cout << getIngredients()[i];
-            if (i != getIngredients().size() - 1) {
+        for (size_t i = 0; i < getIngredientCount(); ++i) {
+            std::cout << getIngredient(i);
+            if (i != getIngredientCount() - 1) {
                 std::cout << ", ";
             }
         }
@@ -113,15 +118,7 @@ bool Dessert::containsNuts() const {
         std::cout << "Preparation Time: " << getPrepTime() << " minutes" << std::endl;
         std::cout << std::fixed << std::setprecision(2) << "Price: $" << getPrice() << std::endl;
         std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
-        std::cout << "Flavor Profile: ";
-        switch (getFlavorProfile()) {
-            case Dessert::SWEET: std::cout << "Sweet"; break;
-            case Dessert::BITTER: std::cout << "Bitter"; break;
-            case Dessert::SOUR: std::cout << "Sour"; break;
-            case Dessert::SALTY: std::cout << "Salty"; break;
-            case Dessert::UMAMI: std::cout << "Umami"; break;
-        }
-        std::cout << std::endl;
+        std::cout << "Flavor Profile: " << enumLabel(FLAVOR_PROFILE_TABLE, getFlavorProfile()) << std::endl;
         std::cout << "Sweetness Level: " << getSweetnessLevel() << std::endl;
         std::cout << "Contains Nuts: ";
         if (containsNuts()) std::cout << "Yes" ; else std::cout << "No"; // I did this just by going from the dome so check this if it doesnt display properly
@@ -147,38 +144,28 @@ bool Dessert::containsNuts() const {
     "Butter", "Cream", "Yogurt".
     */
     void Dessert::dietaryAccommodations(const Dish::DietaryRequest request){
+        applyDietaryRules(DishRecord::DESSERT, request);
         if(request.nut_free){
             setContainsNuts(0);
-            std::string s;
-            std::vector<std::string> nutty = {"Almonds", "Walnuts", "Pecans", "Hazelnuts", "Peanuts", "Cashews", "Pistachios"};
-            std::vector<std::string> ingrid = getIngredients();
-            for (int i = 0; i < (int) ingrid.size(); ++i) {
-                for (auto &&j : nutty){
-                    if(j == ingrid[i]){
-                        auto pos = ingrid.begin() + i; // check that this removes properly
-                        ingrid.erase(pos);
-                    }
-                }
-            }
-            setIngredients(ingrid);
         }
         if(request.low_sugar){
             if(getSweetnessLevel() - 3 > 0){
                 setSweetnessLevel(getSweetnessLevel() - 3);
             } else setSweetnessLevel(0);
         }
-        if(request.vegan){
-            std::string s;
-            std::vector<std::string> nonVeg = {"Milk", "Eggs", "Cheese", "Butter", "Cream", "Yogurt"};
-            std::vector<std::string> ingrid = getIngredients();
-            for (int i = 0; i < (int) ingrid.size(); ++i) {
-                for (auto &&j : nonVeg){
-                    if(j == ingrid[i]){
-                        auto pos = ingrid.begin() + i; // check that this removes properly
-                        ingrid.erase(pos);
-                    }
-                }
-            }
-            setIngredients(ingrid);
-        }
-    }
\ No newline at end of file
+    }
+
+Dessert* Dessert::clone() const {
+    return new Dessert(*this);
+}
+
+std::uint8_t Dessert::dietaryProfile() const {
+    std::uint8_t profile = Dish::dietaryProfile();
+    if (contains_nuts_) {
+        profile &= ~NUT_FREE;
+    }
+    if (getSweetnessLevel() > 0) {
+        profile &= ~LOW_SUGAR;
+    }
+    return profile;
+}
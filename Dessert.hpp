@@ -13,13 +13,14 @@
 #define DESSERT_HPP
 
 #include "Dish.hpp"
+#include "ObjectPool.hpp"
 #include <string>
 
 /**
  * @class Dessert
  * @brief Represents a dessert dish, inheriting from Dish.
  */
-class Dessert : public Dish {
+class Dessert : public Dish, public PoolAllocated<Dessert> {
 public:
     /**
      * @enum FlavorProfile
@@ -124,6 +125,16 @@ public:
     */
     void dietaryAccommodations(const Dish::DietaryRequest request);
 
+    /**
+     * @return A new Dessert with the same fields, allocated from pool().
+     */
+    Dessert* clone() const override;
+
+    /**
+     * @return Dish::dietaryProfile(), where nut_free also needs the contains-nuts flag to be off, and low_sugar needs a sweetness level of 0.
+     */
+    std::uint8_t dietaryProfile() const override;
+
 private:
     FlavorProfile flavor_profile_; ///< The flavor profile of the dessert.
     int sweetness_level_; ///< The sweetness level of the dessert.
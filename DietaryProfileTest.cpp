@@ -0,0 +1,88 @@
+/**
+ * @file DietaryProfileTest.cpp
+ * @brief Checks Dish::dietaryProfile() of dishes built from rows of Dishes.csv, before and after
+ * their dietary accommodations. Run with `make test`; exits non-zero if a check fails.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "DishParser.hpp"
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+std::unique_ptr<Dish> dishFromRow(const std::string& row) {
+    DishRecord record;
+    if (!parseDishRecord(row, record)) {
+        std::cout << "FAILED: could not parse " << row << std::endl;
+        failures++;
+        return nullptr;
+    }
+    return std::unique_ptr<Dish>(createDish(record));
+}
+
+bool satisfies(const Dish& dish, std::uint8_t mask) {
+    return (dish.dietaryProfile() & mask) == mask;
+}
+
+// Rows 2 and 3 of Dishes.csv
+const std::string SAUSAGE_ROLLS =
+    "APPETIZER,Sausage Rolls,Puff Pastry;Sausage Meat;Herbs;Egg Wash,20,5.99,BRITISH,FAMILY_STYLE;1;false";
+const std::string SPAGHETTI_BOLOGNESE =
+    "MAINCOURSE,Spaghetti Bolognese,Spaghetti;Ground Beef;Tomato Sauce;Onions,40,12.99,ITALIAN,"
+    "BOILED;Beef;Garlic Bread:BREAD|Side Salad:SALAD;false";
+
+void testSausageRolls() {
+    std::unique_ptr<Dish> dish = dishFromRow(SAUSAGE_ROLLS);
+    if (!dish) {
+        return;
+    }
+    // Vegetarian: No, although no ingredient is in the MEAT class
+    check(!satisfies(*dish, Dish::VEGETARIAN), "Sausage Rolls are not vegetarian");
+    check(!satisfies(*dish, Dish::VEGAN), "Sausage Rolls are not vegan");
+
+    Dish::DietaryRequest vegetarian;
+    vegetarian.vegetarian = true;
+    check(satisfies(dish->dietaryView(vegetarian), Dish::VEGETARIAN),
+          "Sausage Rolls are vegetarian once accommodated");
+    dish->dietaryAccommodations(vegetarian);
+    check(satisfies(*dish, Dish::VEGETARIAN), "accommodated Sausage Rolls are vegetarian");
+}
+
+void testSpaghettiBolognese() {
+    std::unique_ptr<Dish> dish = dishFromRow(SPAGHETTI_BOLOGNESE);
+    if (!dish) {
+        return;
+    }
+    // The protein is Beef, whatever the ingredient classes say about Ground Beef
+    check(!satisfies(*dish, Dish::VEGETARIAN), "Spaghetti Bolognese is not vegetarian");
+    check(!satisfies(*dish, Dish::VEGAN), "Spaghetti Bolognese is not vegan");
+
+    Dish::DietaryRequest vegan;
+    vegan.vegan = true;
+    check(satisfies(dish->dietaryView(vegan), Dish::VEGAN), "Spaghetti Bolognese is vegan once accommodated");
+    dish->dietaryAccommodations(vegan);
+    check(satisfies(*dish, Dish::VEGAN), "accommodated Spaghetti Bolognese is vegan");
+}
+
+} // namespace
+
+int main() {
+    testSausageRolls();
+    testSpaghettiBolognese();
+    if (failures == 0) {
+        std::cout << "All dietary profile checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
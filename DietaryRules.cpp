@@ -0,0 +1,209 @@
+/**
+ * @file DietaryRules.cpp
+ * @brief This file contains the implementation of the DietaryRules class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "DietaryRules.hpp"
+#include "EnumTables.hpp"
+#include <fstream>
+#include <iostream>
+#include <mutex>
+
+namespace {
+
+// Indexed by class bit position
+constexpr EnumTable<IngredientPool::CLASS_COUNT> INGREDIENT_CLASS_TABLE = makeEnumTable<IngredientPool::CLASS_COUNT>(
+    {"MEAT", "DAIRY_EGG", "GLUTEN", "NUTS"},
+    {"Meat", "Dairy/Egg", "Gluten", "Nuts"});
+
+constexpr EnumTable<6> DIETARY_REQUEST_TABLE = makeEnumTable<6>(
+    {"vegetarian", "vegan", "gluten_free", "nut_free", "low_sodium", "low_sugar"},
+    {"Vegetarian", "Vegan", "Gluten Free", "Nut Free", "Low Sodium", "Low Sugar"});
+
+// In the order of DIETARY_REQUEST_TABLE
+constexpr bool Dish::DietaryRequest::* REQUEST_FIELDS[] = {
+    &Dish::DietaryRequest::vegetarian, &Dish::DietaryRequest::vegan, &Dish::DietaryRequest::gluten_free,
+    &Dish::DietaryRequest::nut_free, &Dish::DietaryRequest::low_sodium, &Dish::DietaryRequest::low_sugar};
+
+static_assert(INGREDIENT_CLASS_TABLE.valid() && DIETARY_REQUEST_TABLE.valid(), "no perfect hash seed found");
+
+const char* const DEFAULT_RULES[] = {
+    "rule APPETIZER vegetarian replace MEAT Beans;Mushrooms",
+    "rule APPETIZER gluten_free remove GLUTEN",
+    "rule MAINCOURSE vegetarian replace MEAT Beans;Mushrooms",
+    "rule MAINCOURSE vegan remove DAIRY_EGG",
+    "rule DESSERT nut_free remove NUTS",
+    "rule DESSERT vegan remove DAIRY_EGG",
+};
+
+/**
+ * Cuts the next space-separated word off the front of rest.
+ * @post rest starts after the word and the spaces that follow it.
+ */
+std::string_view nextWord(std::string_view& rest) {
+    size_t start = rest.find_first_not_of(' ');
+    if (start == std::string_view::npos) {
+        rest = std::string_view();
+        return rest;
+    }
+    rest.remove_prefix(start);
+    size_t end = rest.find(' ');
+    std::string_view word = rest.substr(0, end);
+    rest = (end == std::string_view::npos) ? std::string_view() : rest.substr(end);
+    size_t next = rest.find_first_not_of(' ');
+    rest = (next == std::string_view::npos) ? std::string_view() : rest.substr(next);
+    return word;
+}
+
+} // namespace
+
+DietaryRules& DietaryRules::global() {
+    static DietaryRules rules;
+    return rules;
+}
+
+DietaryRules::DietaryRules() {
+    for (const char* rule : DEFAULT_RULES) {
+        addDirective(rule);
+    }
+}
+
+bool DietaryRules::load(const std::string& path) {
+    std::ifstream f(path);
+
+    // Check if the file is successfully opened
+    if (!f.is_open()) {
+        std::cout << "Error opening the file!";
+        return false;
+    }
+
+    bool valid = true;
+    std::string line;
+    while (getline(f, line)) {
+        valid = addDirective(line) && valid;
+    }
+    return valid;
+}
+
+bool DietaryRules::addDirective(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    std::string_view rest = line;
+    std::string_view keyword = nextWord(rest);
+    if (keyword.empty() || keyword.front() == '#') {
+        return true;
+    }
+
+    if (keyword == "class") {
+        int bit = INGREDIENT_CLASS_TABLE.find(nextWord(rest));
+        if (bit < 0) {
+            return false;
+        }
+        IngredientPool::IngredientClass ingredient_class = static_cast<IngredientPool::IngredientClass>(1 << bit);
+        for (const std::string& name : splitIngredients(rest)) {
+            IngredientPool::global().addToClass(name, ingredient_class);
+        }
+        return true;
+    }
+
+    if (keyword != "rule") {
+        return false;
+    }
+    int kind = DISH_KIND_TABLE.find(nextWord(rest));
+    int request = DIETARY_REQUEST_TABLE.find(nextWord(rest));
+    std::string_view action = nextWord(rest);
+    int bit = INGREDIENT_CLASS_TABLE.find(nextWord(rest));
+    if (kind < 0 || request < 0 || bit < 0 || (action != "replace" && action != "remove")) {
+        return false;
+    }
+    if (action == "remove" && !rest.empty()) {
+        return false;
+    }
+
+    Rule rule;
+    rule.request = request;
+    rule.classes = static_cast<std::uint8_t>(1 << bit);
+    rule.replacements = internIngredients(rest).toVector();
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    rule_generation_.fetch_add(1, std::memory_order_release);
+    for (Rule& existing : rules_[kind]) {
+        if (existing.request == rule.request && existing.classes == rule.classes) {
+            existing = std::move(rule);
+            return true;
+        }
+    }
+    rules_[kind].push_back(std::move(rule));
+    return true;
+}
+
+std::uint32_t DietaryRules::ruleGeneration() const {
+    return rule_generation_.load(std::memory_order_acquire);
+}
+
+std::uint8_t DietaryRules::classesAffected(DishRecord::Kind kind, const Dish::DietaryRequest& request) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::uint8_t classes = 0;
+    for (const Rule& rule : rules_[kind]) {
+        if (request.*REQUEST_FIELDS[rule.request]) {
+            classes |= rule.classes;
+        }
+    }
+    return classes;
+}
+
+void DietaryRules::apply(DishRecord::Kind kind, const Dish::DietaryRequest& request,
+                         Dish::IngredientList& ingredients) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    // The rules this request turns on, each with the number of replacements it has handed out
+    SmallVector<std::pair<const Rule*, std::size_t>, 8> active;
+    for (const Rule& rule : rules_[kind]) {
+        if (request.*REQUEST_FIELDS[rule.request]) {
+            active.push_back({&rule, 0});
+        }
+    }
+    if (active.empty()) {
+        return;
+    }
+
+    // The classes are read from the pool each time, so classes added after the dish was built count
+    const IngredientPool& pool = IngredientPool::global();
+    SmallVector<std::uint8_t, 16> ingredient_classes;
+    ingredient_classes.reserve(ingredients.size());
+    for (std::size_t i = 0; i < ingredients.size(); i++) {
+        ingredient_classes.push_back(0);
+    }
+    pool.classesOfEach(ingredients.begin(), ingredients.end(), ingredient_classes.begin());
+
+    // One stable pass: each ingredient runs through the active rules in order, and the ones that
+    // survive are written back over the removed ones
+    std::size_t keep = 0;
+    for (std::size_t i = 0; i < ingredients.size(); i++) {
+        IngredientId id = ingredients[i];
+        std::uint8_t classes = ingredient_classes[i];
+        bool removed = false;
+        for (std::size_t r = 0; r < active.size() && !removed; r++) {
+            const Rule& rule = *active[r].first;
+            if (!(classes & rule.classes)) {
+                continue;
+            }
+            std::size_t& used = active[r].second;
+            if (used < rule.replacements.size()) {
+                id = rule.replacements[used++];
+                classes = pool.classesOf(id);
+            } else {
+                removed = true;
+            }
+        }
+        if (!removed) {
+            ingredients[keep++] = id;
+        }
+    }
+    while (ingredients.size() > keep) {
+        ingredients.pop_back();
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file DietaryRules.hpp
+ * @brief This file contains the interface of the DietaryRules class, the substitution and removal
+ * rules that the dietary accommodations apply to a dish's ingredients.
+ *
+ * Rules are compiled once into a per-dish-type rule list, and class directives go straight into
+ * IngredientPool::global(), the one table of ingredient classes. Applying a request to a dish is
+ * one class lookup per ingredient, under a single pool lock, and one stable compaction pass, no
+ * matter how many classes and rules there are.
+ *
+ * A rules file has one directive per line; blank lines and lines starting with '#' are skipped:
+ *
+ *     class <CLASS> <ingredient>;<ingredient>;...
+ *     rule <DISHTYPE> <request> replace <CLASS> <replacement>;<replacement>;...
+ *     rule <DISHTYPE> <request> remove <CLASS>
+ *
+ * CLASS is MEAT, DAIRY_EGG, GLUTEN or NUTS. DISHTYPE is APPETIZER, MAINCOURSE or DESSERT. request
+ * is a DietaryRequest field: vegetarian, vegan, gluten_free, nut_free, low_sodium or low_sugar.
+ * A replace rule swaps the first matching ingredients for the replacements, in order, and removes
+ * the matches after that.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef DIETARYRULES_HPP
+#define DIETARYRULES_HPP
+
+#include "Dish.hpp"
+#include "DishParser.hpp"
+#include "IngredientPool.hpp"
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class DietaryRules
+ * @brief A compiled set of dietary rules. All member functions are safe to call from several threads.
+ */
+class DietaryRules {
+public:
+    /**
+     * @return The rules used by every Dish's dietaryAccommodations.
+     */
+    static DietaryRules& global();
+
+    /**
+     * Default constructor.
+     * @post The rules are:
+     * APPETIZER vegetarian replaces MEAT with Beans, Mushrooms; APPETIZER gluten_free removes GLUTEN;
+     * MAINCOURSE vegetarian replaces MEAT with Beans, Mushrooms; MAINCOURSE vegan removes DAIRY_EGG;
+     * DESSERT nut_free removes NUTS; DESSERT vegan removes DAIRY_EGG.
+     */
+    DietaryRules();
+    DietaryRules(const DietaryRules&) = delete;
+    DietaryRules& operator=(const DietaryRules&) = delete;
+
+    /**
+     * Adds the directives of a rules file to the current rules.
+     * @param path The rules file.
+     * @return True if the file was read and every directive in it was valid.
+     * @post Valid directives are added even if others are not. A rule for a dish type, request
+     * and class that already has one replaces it. Class directives take effect on dishes that
+     * already exist too: their allergen masks are recomputed when next read.
+     */
+    bool load(const std::string& path);
+
+    /**
+     * Adds one directive.
+     * @return True if the line is a valid directive, blank or a comment.
+     */
+    bool addDirective(std::string_view line);
+
+    /**
+     * @return A counter that every added or replaced rule bumps, for caches of applied rules to
+     * check against, like IngredientPool::classGeneration() for the classes.
+     */
+    std::uint32_t ruleGeneration() const;
+
+    /**
+     * @return The classes that the rules for kind act on when request is applied, as a mask of
+     * IngredientPool::IngredientClass bits. Dishes with none of them can skip apply().
+     */
+    std::uint8_t classesAffected(DishRecord::Kind kind, const Dish::DietaryRequest& request) const;
+
+    /**
+     * Applies the rules for kind to ingredients, in the order they were added.
+     * @post Matching ingredients have been replaced or removed; the others keep their order.
+     */
+    void apply(DishRecord::Kind kind, const Dish::DietaryRequest& request, Dish::IngredientList& ingredients) const;
+
+private:
+    /**
+     * @struct Rule
+     * @brief One compiled rule of a dish type.
+     */
+    struct Rule {
+        int request = 0;                         // Index into the DietaryRequest fields
+        std::uint8_t classes = 0;                // Ingredients of these classes match
+        std::vector<IngredientId> replacements;  // Empty for a remove rule
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Rule> rules_[3]; // Indexed by DishRecord::Kind
+    std::atomic<std::uint32_t> rule_generation_{0}; // Bumped under the unique lock
+};
+
+#endif // DIETARYRULES_HPP
@@ -0,0 +1,83 @@
+/**
+ * @file DietaryViewTest.cpp
+ * @brief Checks that Dish::dietaryView() follows ingredient classes and rules added after a view
+ * was taken. Run with `make test`; exits non-zero if a check fails.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "DietaryRules.hpp"
+#include "DishParser.hpp"
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+std::string ingredientsOf(const Dish& dish) {
+    std::string joined;
+    for (const std::string& ingredient : dish.getIngredients()) {
+        joined += (joined.empty() ? "" : " ") + ingredient;
+    }
+    return joined;
+}
+
+/**
+ * @return The dish's ingredients after its dietary accommodations, applied to a copy.
+ */
+std::string accommodatedIngredientsOf(const Dish& dish, const Dish::DietaryRequest& request) {
+    std::unique_ptr<Dish> adjusted(dish.clone());
+    adjusted->dietaryAccommodations(request);
+    return ingredientsOf(*adjusted);
+}
+
+void testClassAddedAfterView(const Dish& dish, const Dish::DietaryRequest& vegetarian) {
+    const Dish& before = dish.dietaryView(vegetarian);
+    check(ingredientsOf(before) == "Rice Herbs", "Rice is not meat yet: " + ingredientsOf(before));
+
+    DietaryRules::global().addDirective("class MEAT Rice");
+    const Dish& after = dish.dietaryView(vegetarian);
+    check(ingredientsOf(after) == "Beans Herbs", "the view replaces Rice once it is meat: " + ingredientsOf(after));
+    check(ingredientsOf(after) == accommodatedIngredientsOf(dish, vegetarian),
+          "the view matches the accommodations after a class directive");
+    // A reference taken before the change stays valid until the dish itself changes
+    check(ingredientsOf(before) == "Rice Herbs", "the earlier view is still readable");
+}
+
+void testRuleAddedAfterView(const Dish& dish, const Dish::DietaryRequest& vegetarian) {
+    dish.dietaryView(vegetarian);
+    DietaryRules::global().addDirective("rule APPETIZER vegetarian replace MEAT Tempeh");
+    const Dish& after = dish.dietaryView(vegetarian);
+    check(ingredientsOf(after) == "Tempeh Herbs", "the view uses the replacing rule: " + ingredientsOf(after));
+    check(ingredientsOf(after) == accommodatedIngredientsOf(dish, vegetarian),
+          "the view matches the accommodations after a rule directive");
+}
+
+} // namespace
+
+int main() {
+    DishRecord record;
+    if (!parseDishRecord("APPETIZER,Rice Cakes,Rice;Herbs,10,4.99,OTHER,FAMILY_STYLE;1;true", record)) {
+        std::cout << "FAILED: could not parse the test row" << std::endl;
+        return 1;
+    }
+    std::unique_ptr<Dish> dish(createDish(record));
+    Dish::DietaryRequest vegetarian;
+    vegetarian.vegetarian = true;
+
+    testClassAddedAfterView(*dish, vegetarian);
+    testRuleAddedAfterView(*dish, vegetarian);
+    if (failures == 0) {
+        std::cout << "All dietary view checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -11,16 +11,21 @@
  */
 
 #include "Dish.hpp"
+#include "DietaryRules.hpp"
+#include "EnumTables.hpp"
+#include <cstring>
 
 // Default Constructor
 Dish::Dish() 
-    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    : name_("UNKNOWN"), ingredients_(), allergens_(0), allergen_generation_(0), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    updateFingerprint();
 }
 
 // Parameterized Constructor
 Dish::Dish(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type)
-    : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
-    setName(name);  // Use setName to validate the name
+    : allergens_(0), allergen_generation_(0), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
+    setIngredients(ingredients);
+    setName(name);  // Use setName to validate the name (also computes the fingerprint)
 }
 
 // Accessor Functions
@@ -29,6 +34,29 @@ std::string Dish::getName() const {
 }
 
 std::vector<std::string> Dish::getIngredients() const {
+    const IngredientPool& pool = IngredientPool::global();
+    std::vector<std::string> ingredients;
+    ingredients.reserve(ingredients_.size());
+    for (IngredientId id : ingredients_) {
+        ingredients.push_back(pool.name(id));
+    }
+    return ingredients;
+}
+
+std::size_t Dish::getIngredientCount() const {
+    return ingredients_.size();
+}
+
+const std::string& Dish::getIngredient(std::size_t i) const {
+    return IngredientPool::global().name(ingredients_[i]);
+}
+
+const Dish::IngredientList& Dish::getIngredientIds() const {
+    return ingredients_;
+}
+
+Dish::IngredientList& Dish::ingredientIds() {
+    invalidateViews(); // The caller is about to edit the ingredients
     return ingredients_;
 }
 
@@ -41,40 +69,57 @@ double Dish::getPrice() const {
 }
 
 std::string Dish::getCuisineType() const {
-    switch (cuisine_type_) {
-        case CuisineType::ITALIAN: return "ITALIAN";
-        case CuisineType::MEXICAN: return "MEXICAN";
-        case CuisineType::CHINESE: return "CHINESE";
-        case CuisineType::INDIAN: return "INDIAN";
-        case CuisineType::AMERICAN: return "AMERICAN";
-        case CuisineType::FRENCH: return "FRENCH";
-        default: return "OTHER";
-    }
+    return std::string(enumName(CUISINE_TYPE_TABLE, cuisine_type_));
+}
+
+Dish::CuisineType Dish::getCuisineTypeEnum() const {
+    return cuisine_type_;
 }
 
 // Mutator Functions
 void Dish::setName(const std::string& name) {
+    invalidateViews();
     if (isValidName(name)) {
         name_ = name;
     } else {
         name_ = "UNKNOWN";
     }
+    updateFingerprint();
 }
 
 void Dish::setIngredients(const std::vector<std::string>& ingredients) {
-    ingredients_ = ingredients;
+    invalidateViews();
+    IngredientPool& pool = IngredientPool::global();
+    ingredients_.clear();
+    ingredients_.reserve(ingredients.size());
+    for (const std::string& ingredient : ingredients) {
+        ingredients_.push_back(pool.intern(ingredient));
+    }
+    updateAllergens();
+}
+
+void Dish::setIngredientIds(const IngredientList& ingredient_ids) {
+    invalidateViews();
+    ingredients_ = ingredient_ids;
+    updateAllergens();
 }
 
 void Dish::setPrepTime(const int& prep_time) {
+    invalidateViews();
     prep_time_ = prep_time;
+    updateFingerprint();
 }
 
 void Dish::setPrice(const double& price) {
+    invalidateViews();
     price_ = price;
+    updateFingerprint();
 }
 
 void Dish::setCuisineType(const CuisineType& cuisine_type) {
+    invalidateViews();
     cuisine_type_ = cuisine_type;
+    updateFingerprint();
 }
 
 // Display Function
@@ -93,6 +138,13 @@ void Dish::setCuisineType(const CuisineType& cuisine_type) {
     std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
 } */
 
+// Sets the name without validating it, for a snapshot restore
+void Dish::restoreName(std::string name) {
+    invalidateViews();
+    name_ = std::move(name);
+    updateFingerprint();
+}
+
 // Helper function to check if the name is valid
 bool Dish::isValidName(const std::string& name) const {
     for (char c : name) {
@@ -104,7 +156,8 @@ bool Dish::isValidName(const std::string& name) const {
 }
 
 bool Dish::operator==(const Dish& rhs) const {
-    return name_ == rhs.name_ && prep_time_ == rhs.prep_time_ && 
+    // Different fingerprints rule equality out without touching the names
+    return fingerprint_ == rhs.fingerprint_ && name_ == rhs.name_ && prep_time_ == rhs.prep_time_ && 
     price_ == rhs.price_ && cuisine_type_ == rhs.cuisine_type_;
 }
 
@@ -112,6 +165,191 @@ bool Dish::operator!=(const Dish& rhs) const {
     return !(*this == rhs);
 }
 
+bool Dish::isElaborate() const {
+    return ingredients_.size() >= 5 && prep_time_ >= 60;
+}
+
+std::uint8_t Dish::getAllergens() const {
+    const IngredientPool& pool = IngredientPool::global();
+    if (allergen_generation_ != pool.classGeneration()) {
+        // A class changed since the mask was computed; read the classes afresh
+        return pool.classesOf(ingredients_.begin(), ingredients_.end());
+    }
+    return allergens_;
+}
+
+bool Dish::hasAllergens(std::uint8_t allergens) const {
+    return (getAllergens() & allergens) != 0;
+}
+
+bool Dish::isVeganCompatible() const {
+    return !hasAllergens(IngredientPool::MEAT | IngredientPool::DAIRY_EGG);
+}
+
+std::uint8_t Dish::dietaryProfile() const {
+    DietaryRequest satisfied;
+    satisfied.vegetarian = !hasAllergens(IngredientPool::MEAT);
+    satisfied.vegan = isVeganCompatible();
+    satisfied.gluten_free = !hasAllergens(IngredientPool::GLUTEN);
+    satisfied.nut_free = !hasAllergens(IngredientPool::NUTS);
+    satisfied.low_sodium = true; // Only appetizers have a spiciness level to lower
+    satisfied.low_sugar = true;  // Only desserts have a sweetness level to lower
+    return requestMask(satisfied);
+}
+
+void Dish::updateAllergens() {
+    // Read the generation first, so a class changed while the mask is computed leaves it stale
+    allergen_generation_ = IngredientPool::global().classGeneration();
+    allergens_ = IngredientPool::global().classesOf(ingredients_.begin(), ingredients_.end());
+}
+
+std::uint8_t Dish::requestMask(const DietaryRequest& request) {
+    return (request.vegetarian ? VEGETARIAN : 0) | (request.vegan ? VEGAN : 0) |
+           (request.gluten_free ? GLUTEN_FREE : 0) | (request.nut_free ? NUT_FREE : 0) |
+           (request.low_sodium ? LOW_SODIUM : 0) | (request.low_sugar ? LOW_SUGAR : 0);
+}
+
+Dish::DietaryRequest Dish::requestFromMask(std::uint8_t mask) {
+    DietaryRequest request;
+    request.vegetarian = mask & VEGETARIAN;
+    request.vegan = mask & VEGAN;
+    request.gluten_free = mask & GLUTEN_FREE;
+    request.nut_free = mask & NUT_FREE;
+    request.low_sodium = mask & LOW_SODIUM;
+    request.low_sugar = mask & LOW_SUGAR;
+    return request;
+}
+
+const Dish& Dish::dietaryView(const DietaryRequest& request) const {
+    std::uint8_t mask = requestMask(request);
+    if (mask == 0) {
+        return *this; // An empty request changes nothing
+    }
+    // Read the generations first, so a class or rule changed while the view is built leaves it stale
+    std::uint64_t generation = ViewCache::generationNow();
+    const Dish* view = views_.find(mask, generation);
+    if (view == nullptr) {
+        Dish* adjusted = clone();
+        adjusted->dietaryAccommodations(request);
+        view = views_.insert(mask, adjusted, generation);
+    }
+    return *view;
+}
+
+void Dish::applyDietaryRules(int kind, const DietaryRequest& request) {
+    invalidateViews();
+    // The allergen mask rules the engine out when no ingredient is in a class the request touches
+    const DietaryRules& rules = DietaryRules::global();
+    DishRecord::Kind record_kind = static_cast<DishRecord::Kind>(kind);
+    if (hasAllergens(rules.classesAffected(record_kind, request))) {
+        rules.apply(record_kind, request, ingredientIds());
+        updateAllergens();
+    }
+}
+
+void Dish::invalidateViews() {
+    views_.clear();
+}
+
+Dish::ViewCache::Table::Table(std::uint64_t generation) : generation(generation) {
+    for (std::atomic<const Dish*>& view : views) {
+        view.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+Dish::ViewCache& Dish::ViewCache::operator=(const ViewCache&) noexcept {
+    clear(); // The views described the dish before the assignment
+    return *this;
+}
+
+Dish::ViewCache::~ViewCache() {
+    clear();
+}
+
+std::uint64_t Dish::ViewCache::generationNow() {
+    return (std::uint64_t(IngredientPool::global().classGeneration()) << 32) | DietaryRules::global().ruleGeneration();
+}
+
+const Dish* Dish::ViewCache::find(std::uint8_t mask, std::uint64_t generation) {
+    Table* table = current(generation, false);
+    return table == nullptr ? nullptr : table->views[mask].load(std::memory_order_acquire);
+}
+
+const Dish* Dish::ViewCache::insert(std::uint8_t mask, const Dish* view, std::uint64_t generation) {
+    Table* table = current(generation, true);
+    const Dish* expected = nullptr;
+    if (table->views[mask].compare_exchange_strong(expected, view, std::memory_order_acq_rel)) {
+        return view;
+    }
+    delete view;
+    return expected;
+}
+
+Dish::ViewCache::Table* Dish::ViewCache::current(std::uint64_t generation, bool create) {
+    Table* table = table_.load(std::memory_order_acquire);
+    while (table == nullptr ? create : table->generation != generation) {
+        Table* fresh = create ? new Table(generation) : nullptr;
+        if (table_.compare_exchange_weak(table, fresh, std::memory_order_acq_rel)) {
+            retire(table);
+            return fresh;
+        }
+        delete fresh; // table now holds the one another thread installed; check it again
+    }
+    return table;
+}
+
+void Dish::ViewCache::retire(Table* table) {
+    if (table == nullptr) {
+        return;
+    }
+    Table* head = retired_.load(std::memory_order_relaxed);
+    do {
+        table->next_retired = head;
+    } while (!retired_.compare_exchange_weak(head, table, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void Dish::ViewCache::clear() {
+    destroy(table_.exchange(nullptr, std::memory_order_acq_rel));
+    Table* retired = retired_.exchange(nullptr, std::memory_order_acq_rel);
+    while (retired != nullptr) {
+        Table* next = retired->next_retired;
+        destroy(retired);
+        retired = next;
+    }
+}
+
+void Dish::ViewCache::destroy(Table* table) {
+    if (table == nullptr) {
+        return;
+    }
+    for (std::atomic<const Dish*>& view : table->views) {
+        delete view.load(std::memory_order_relaxed);
+    }
+    delete table;
+}
+
+std::uint64_t Dish::getFingerprint() const {
+    return fingerprint_;
+}
+
+void Dish::updateFingerprint() {
+    // FNV-1a over the name, then the other identity fields
+    const std::uint64_t PRIME = 1099511628211ull;
+    std::uint64_t h = 14695981039346656037ull;
+    for (char c : name_) {
+        h = (h ^ static_cast<unsigned char>(c)) * PRIME;
+    }
+    double price = (price_ == 0.0) ? 0.0 : price_; // -0.0 == 0.0, so they must hash alike
+    std::uint64_t price_bits;
+    std::memcpy(&price_bits, &price, sizeof(price_bits));
+    for (std::uint64_t field : {static_cast<std::uint64_t>(static_cast<std::uint32_t>(prep_time_)), price_bits,
+                                static_cast<std::uint64_t>(cuisine_type_)}) {
+        h = (h ^ field) * PRIME;
+        h ^= h >> 29;
+    }
+    fingerprint_ = h;
+}
+
 
 /**
 * Modifies the dish to accommodate specific dietary needs.
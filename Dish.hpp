@@ -18,11 +18,19 @@
 #include <iostream>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include "IngredientPool.hpp"
+#include "SmallVector.hpp"
 
 class Dish {
 public:
     // CuisineType enum definition
     enum CuisineType { ITALIAN, MEXICAN, CHINESE, INDIAN, AMERICAN, FRENCH, OTHER };
+
+    // Most dishes have at most 8 ingredients, which then live inside the Dish with no allocation
+    typedef SmallVector<IngredientId, 8> IngredientList;
     /**
     * Structure to store dietary accommodation details.
     */
@@ -35,6 +43,15 @@ public:
     bool low_sugar = false;
     };
 
+    /**
+     * A DietaryRequest packed into 6 bits, one per field.
+     */
+    enum RequestBit : std::uint8_t { VEGETARIAN = 1 << 0, VEGAN = 1 << 1, GLUTEN_FREE = 1 << 2,
+                                     NUT_FREE = 1 << 3, LOW_SODIUM = 1 << 4, LOW_SUGAR = 1 << 5 };
+    static const int REQUEST_MASK_COUNT = 64;
+    static std::uint8_t requestMask(const DietaryRequest& request);
+    static DietaryRequest requestFromMask(std::uint8_t mask);
+
     // Constructors
     /**
      * Default constructor.
@@ -49,6 +66,12 @@ public:
 
     virtual ~Dish();
 
+    // Dishes can also be held by value (see FlatKitchen), so they must stay cheap to move
+    Dish(const Dish&) = default;
+    Dish(Dish&&) = default;
+    Dish& operator=(const Dish&) = default;
+    Dish& operator=(Dish&&) = default;
+
     /**
      * Parameterized constructor.
      * @param name A reference to the name of the dish.
@@ -67,10 +90,27 @@ public:
     std::string getName() const;
 
     /**
-     * @return The list of ingredients used in the dish.
+     * @return A copy of the list of ingredients used in the dish. Prefer the accessors below
+     * when a copy is not needed.
      */
     std::vector<std::string> getIngredients() const;
 
+    /**
+     * @return The number of ingredients used in the dish.
+     */
+    std::size_t getIngredientCount() const;
+
+    /**
+     * @param i The position of the ingredient, less than getIngredientCount().
+     * @return The name of the ingredient at position i, without copying it.
+     */
+    const std::string& getIngredient(std::size_t i) const;
+
+    /**
+     * @return The ingredients as ids in IngredientPool::global(), in the same order as getIngredients().
+     */
+    const IngredientList& getIngredientIds() const;
+
     /**
      * @return The preparation time in minutes.
      */
@@ -86,6 +126,11 @@ public:
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return The cuisine type of the dish as a CuisineType enum.
+     */
+    CuisineType getCuisineTypeEnum() const;
+
     // Mutators
     /**
      * Sets the name of the dish.
@@ -101,6 +146,13 @@ public:
      */
     void setIngredients(const std::vector<std::string>& ingredients);
 
+    /**
+     * Sets the list of ingredients from ids in IngredientPool::global().
+     * @param ingredient_ids The new list of ingredient ids.
+     * @post Sets the private member `ingredients_` to the value of the parameter.
+     */
+    void setIngredientIds(const IngredientList& ingredient_ids);
+
     /**
      * Sets the preparation time.
      * @param prep_time The new preparation time in minutes.
@@ -159,15 +211,174 @@ public:
     */
     bool operator!=(const Dish& rhs) const; // Overloading the != operator
 
+    /**
+     * @return A 64-bit hash of the fields that decide equality (name, preparation time, price and
+     * cuisine type). Equal dishes always have equal fingerprints. It is cached and refreshed by
+     * the mutators of those fields.
+     */
+    std::uint64_t getFingerprint() const;
+
+    /**
+     * @return True if the dish has 5 or more ingredients AND takes an hour or more to prepare.
+     */
+    bool isElaborate() const;
+
+    /**
+     * @return The IngredientPool classes (MEAT, DAIRY_EGG, GLUTEN, NUTS) of the dish's ingredients,
+     * as a bitmask. It is computed when the ingredients are set, and read afresh from the pool
+     * while a class has changed since then.
+     */
+    std::uint8_t getAllergens() const;
+
+    /**
+     * @return True if any ingredient of the dish is in one of the classes in the mask.
+     */
+    bool hasAllergens(std::uint8_t allergens) const;
+
+    /**
+     * @return True if no ingredient of the dish is meat, dairy or egg.
+     */
+    bool isVeganCompatible() const;
+
+    /**
+     * Recomputes the allergen mask, e.g. once a class has changed, so getAllergens() stops
+     * reading the classes afresh.
+     * @post `allergens_` is the union of the classes of the current ingredients, as of the class
+     * generation recorded in `allergen_generation_`.
+     */
+    void updateAllergens();
+
+    /**
+     * @return The requests the dish already satisfies, as a request mask (see requestMask()):
+     * vegetarian if no ingredient is meat, vegan if none is meat, dairy or egg, gluten_free if
+     * none has gluten, nut_free if none is a nut. The subtypes narrow these with their own fields.
+     */
+    virtual std::uint8_t dietaryProfile() const;
+
 
     virtual void dietaryAccommodations(const DietaryRequest request) = 0;
 
+    /**
+     * @return A new copy of the dish, of the same type.
+     */
+    virtual Dish* clone() const = 0;
+
+    /**
+     * @param request The dietary accommodations to preview.
+     * @return The dish as dietaryAccommodations(request) would leave it, without changing this dish.
+     * Each request mask's view is built on first use and kept until this dish is next changed,
+     * or a class or rule it was built under changes, so later calls cost a lookup. The reference
+     * is valid until the dish is next changed. Safe to call from several
+     * threads while the dish is not being changed.
+     */
+    const Dish& dietaryView(const DietaryRequest& request) const;
+
+protected:
+    /**
+     * @return The ingredient ids, for the subclasses' dietary accommodations to edit in place.
+     * Call updateAllergens() once done.
+     */
+    IngredientList& ingredientIds();
+
+
+    /**
+     * Starts a dietaryAccommodations override: drops the cached views, then applies the
+     * DietaryRules::global() substitutions and removals for kind to the ingredients.
+     * @param kind The DishRecord::Kind of the dish.
+     * @post The allergen mask describes the new ingredients.
+     */
+    void applyDietaryRules(int kind, const DietaryRequest& request);
+
+    /**
+     * Drops the cached dietary views. Every mutator calls it before changing the dish.
+     */
+    void invalidateViews();
+
 private:
+    /**
+     * @class ViewCache
+     * @brief The dietary views of one dish, one slot per request mask. The table is allocated on
+     * the first view and both it and its slots are filled in with compare-and-swap, so readers
+     * never lock. A copy of a dish starts with an empty cache.
+     *
+     * The table records the ingredient class and rule generations its views were built under. A
+     * lookup under other generations swaps in an empty table and retires the old one, which is
+     * kept until clear() because callers may still hold references to its views.
+     */
+    class ViewCache {
+    public:
+        ViewCache() = default;
+        ViewCache(const ViewCache&) noexcept {}
+        ViewCache& operator=(const ViewCache&) noexcept;
+        ~ViewCache();
+
+        /**
+         * @param generation The class and rule generations the caller read, see generationNow().
+         * @return The view cached for mask under generation, or nullptr.
+         */
+        const Dish* find(std::uint8_t mask, std::uint64_t generation);
+
+        /**
+         * Caches view for mask under generation unless another thread got there first.
+         * @return The view now cached for mask; view is deleted if it lost.
+         */
+        const Dish* insert(std::uint8_t mask, const Dish* view, std::uint64_t generation);
+
+        /**
+         * @post Every cached and retired view is deleted.
+         */
+        void clear();
+
+        /**
+         * @return IngredientPool::classGeneration() and DietaryRules::ruleGeneration(), packed.
+         */
+        static std::uint64_t generationNow();
+
+    private:
+        struct Table {
+            std::atomic<const Dish*> views[REQUEST_MASK_COUNT];
+            std::uint64_t generation;
+            Table* next_retired = nullptr;
+            explicit Table(std::uint64_t generation);
+        };
+        std::atomic<Table*> table_{nullptr};
+        std::atomic<Table*> retired_{nullptr}; // Stack of tables from older generations
+
+        /**
+         * @return The table for generation, creating it if create is true, or nullptr. A table
+         * from another generation is retired.
+         */
+        Table* current(std::uint64_t generation, bool create);
+        void retire(Table* table);
+        static void destroy(Table* table);
+    };
+
     std::string name_;
-    std::vector<std::string> ingredients_;
+    IngredientList ingredients_; // Interned in IngredientPool::global()
+    std::uint8_t allergens_;     // IngredientPool classes of ingredients_
+    std::uint32_t allergen_generation_; // IngredientPool::classGeneration() allergens_ was computed at
     int prep_time_;
     double price_;
     CuisineType cuisine_type_;
+    std::uint64_t fingerprint_;
+    mutable ViewCache views_;    // Dietary views, built lazily by dietaryView()
+
+    /**
+     * Recomputes the cached fingerprint.
+     * @post `fingerprint_` matches the current name, preparation time, price and cuisine type.
+     */
+    void updateFingerprint();
+
+    // Only for restoreName: Kitchen::loadSnapshot restores names that setName already accepted
+    // before they were saved
+    friend class Kitchen;
+
+    /**
+     * Sets the name without validating it, for restoring a snapshot.
+     * @pre name was accepted by setName(), e.g. it is read back from a snapshot of a dish.
+     * @post Sets the private member `name_` to the value of the parameter.
+     */
+    void restoreName(std::string name);
 
     // Helper function to check if the name is valid
     /**
@@ -178,4 +389,16 @@ private:
     bool isValidName(const std::string& name) const;
 };
 
+/**
+ * Hashes a dish by content, consistently with Dish::operator==.
+ */
+namespace std {
+template <>
+struct hash<Dish> {
+    size_t operator()(const Dish& dish) const {
+        return static_cast<size_t>(dish.getFingerprint());
+    }
+};
+} // namespace std
+
 #endif // DISH_HPP
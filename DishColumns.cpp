@@ -0,0 +1,215 @@
+/**
+ * @file DishColumns.cpp
+ * @brief This file contains the implementation of the DishColumns class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "DishColumns.hpp"
+
+namespace {
+
+/**
+ * Moves the last element of a column into row and drops the last element.
+ */
+template <class T>
+void swapRemove(std::vector<T>& column, std::size_t row) {
+    column[row] = column.back();
+    column.pop_back();
+}
+
+/**
+ * Drops the flagged elements of a column, keeping the others in order.
+ */
+template <class T>
+void compactColumn(std::vector<T>& column, const std::vector<char>& removed) {
+    std::size_t keep = 0;
+    for (std::size_t i = 0; i < column.size(); i++) {
+        if (!removed[i]) {
+            column[keep++] = column[i];
+        }
+    }
+    column.resize(keep);
+}
+
+/**
+ * Counts the elements of a byte column equal to value. Written as a plain sum of
+ * comparisons so the compiler can vectorize it.
+ */
+int countEqual(const std::vector<std::uint8_t>& column, std::uint8_t value) {
+    int count = 0;
+    for (std::uint8_t element : column) {
+        count += (element == value);
+    }
+    return count;
+}
+
+} // namespace
+
+std::size_t DishColumns::size() const {
+    return prep_times_.size();
+}
+
+void DishColumns::reserve(std::size_t capacity) {
+    prep_times_.reserve(capacity);
+    cuisine_types_.reserve(capacity);
+    elaborate_.reserve(capacity);
+    allergens_.reserve(capacity);
+    for (std::vector<std::uint64_t>& bitmap : dietary_) {
+        bitmap.reserve((capacity + 63) / 64);
+    }
+}
+
+void DishColumns::clear() {
+    prep_times_.clear();
+    cuisine_types_.clear();
+    elaborate_.clear();
+    allergens_.clear();
+    for (std::vector<std::uint64_t>& bitmap : dietary_) {
+        bitmap.clear();
+    }
+}
+
+void DishColumns::append(const Dish* dish) {
+    prep_times_.push_back(dish->getPrepTime());
+    cuisine_types_.push_back(dish->getCuisineTypeEnum());
+    elaborate_.push_back(dish->isElaborate());
+    allergens_.push_back(dish->getAllergens());
+    std::size_t row = size() - 1;
+    if (row % 64 == 0) {
+        for (std::vector<std::uint64_t>& bitmap : dietary_) {
+            bitmap.push_back(0);
+        }
+    }
+    setDietaryProfile(row, dish->dietaryProfile());
+}
+
+void DishColumns::removeAt(std::size_t row) {
+    std::size_t last = size() - 1;
+    setDietaryProfile(row, dietaryProfile(last));
+    setDietaryProfile(last, 0);
+    if (last % 64 == 0) {
+        for (std::vector<std::uint64_t>& bitmap : dietary_) {
+            bitmap.pop_back();
+        }
+    }
+    swapRemove(prep_times_, row);
+    swapRemove(cuisine_types_, row);
+    swapRemove(elaborate_, row);
+    swapRemove(allergens_, row);
+}
+
+void DishColumns::compact(const std::vector<char>& removed) {
+    std::size_t keep = 0;
+    for (std::size_t row = 0; row < size(); row++) {
+        if (!removed[row]) {
+            setDietaryProfile(keep++, dietaryProfile(row)); // keep <= row, so row is read before it is overwritten
+        }
+    }
+    for (std::size_t row = keep; row < size(); row++) {
+        setDietaryProfile(row, 0);
+    }
+    for (std::vector<std::uint64_t>& bitmap : dietary_) {
+        bitmap.resize((keep + 63) / 64);
+    }
+    compactColumn(prep_times_, removed);
+    compactColumn(cuisine_types_, removed);
+    compactColumn(elaborate_, removed);
+    compactColumn(allergens_, removed);
+}
+
+void DishColumns::refresh(std::size_t row, const Dish* dish) {
+    prep_times_[row] = dish->getPrepTime();
+    cuisine_types_[row] = dish->getCuisineTypeEnum();
+    elaborate_[row] = dish->isElaborate();
+    allergens_[row] = dish->getAllergens();
+    setDietaryProfile(row, dish->dietaryProfile());
+}
+
+int DishColumns::prepTime(std::size_t row) const {
+    return prep_times_[row];
+}
+
+Dish::CuisineType DishColumns::cuisineType(std::size_t row) const {
+    return static_cast<Dish::CuisineType>(cuisine_types_[row]);
+}
+
+bool DishColumns::isElaborate(std::size_t row) const {
+    return elaborate_[row];
+}
+
+std::uint8_t DishColumns::allergens(std::size_t row) const {
+    return allergens_[row];
+}
+
+std::uint8_t DishColumns::dietaryProfile(std::size_t row) const {
+    std::uint8_t profile = 0;
+    for (int i = 0; i < REQUEST_BITS; i++) {
+        profile |= ((dietary_[i][row / 64] >> (row % 64)) & 1) << i;
+    }
+    return profile;
+}
+
+void DishColumns::setDietaryProfile(std::size_t row, std::uint8_t profile) {
+    std::uint64_t bit = std::uint64_t(1) << (row % 64);
+    for (int i = 0; i < REQUEST_BITS; i++) {
+        std::uint64_t& word = dietary_[i][row / 64];
+        word = (profile >> i & 1) ? (word | bit) : (word & ~bit);
+    }
+}
+
+/**
+ * Calls visit(w, bits) for every word w of the bitmaps, where bits has bit r set when row
+ * 64 * w + r exists and satisfies every request in the mask.
+ */
+template <class Visitor>
+void DishColumns::forEachSatisfyingWord(std::uint8_t requests, Visitor visit) const {
+    const std::uint64_t* selected[REQUEST_BITS];
+    int selected_count = 0;
+    for (int i = 0; i < REQUEST_BITS; i++) {
+        if (requests >> i & 1) {
+            selected[selected_count++] = dietary_[i].data();
+        }
+    }
+    std::size_t rows = size();
+    std::size_t words = (rows + 63) / 64;
+    for (std::size_t w = 0; w < words; w++) {
+        // An empty mask matches every row, so start from the rows that exist
+        std::uint64_t bits = (w + 1 < words || rows % 64 == 0) ? ~std::uint64_t(0) : (std::uint64_t(1) << (rows % 64)) - 1;
+        for (int s = 0; s < selected_count; s++) {
+            bits &= selected[s][w];
+        }
+        visit(w, bits);
+    }
+}
+
+int DishColumns::countSatisfying(std::uint8_t requests) const {
+    int count = 0;
+    forEachSatisfyingWord(requests, [&count](std::size_t, std::uint64_t bits) {
+        count += __builtin_popcountll(bits);
+    });
+    return count;
+}
+
+std::vector<int> DishColumns::rowsSatisfying(std::uint8_t requests) const {
+    std::vector<int> rows;
+    forEachSatisfyingWord(requests, [&rows](std::size_t w, std::uint64_t bits) {
+        while (bits != 0) {
+            rows.push_back(static_cast<int>(w * 64 + __builtin_ctzll(bits)));
+            bits &= bits - 1;
+        }
+    });
+    return rows;
+}
+
+int DishColumns::countElaborate() const {
+    return countEqual(elaborate_, 1);
+}
+
+int DishColumns::countFreeOf(std::uint8_t allergens) const {
+    int count = 0;
+    for (std::uint8_t mask : allergens_) {
+        count += (mask & allergens) == 0;
+    }
+    return count;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file DishColumns.hpp
+ * @brief This file contains the interface of the DishColumns class, a struct-of-arrays copy of the
+ * fields that Kitchen aggregates and filters on.
+ *
+ * Row i of every column describes the dish in slot i of the Kitchen, so counting and filtering
+ * walk dense arrays of ints and bytes instead of following Dish* into virtual objects.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef DISHCOLUMNS_HPP
+#define DISHCOLUMNS_HPP
+
+#include "Dish.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class DishColumns
+ * @brief Parallel columns of prep time, cuisine type, elaborate flag and allergen mask,
+ * plus one bitmap per dietary request saying which rows already satisfy it.
+ * The owner keeps the rows in step with its slots: append on add, removeAt on a swap-with-last
+ * remove, compact on a stable bulk remove.
+ */
+class DishColumns {
+public:
+    /**
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @post Every column can hold capacity rows without reallocating.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @post All columns are empty.
+     */
+    void clear();
+
+    /**
+     * Adds a row for a dish that was added to the last slot.
+     * @post The last row holds the dish's fields.
+     */
+    void append(const Dish* dish);
+
+    /**
+     * Removes a row the way IndexedArrayBag::remove removes a slot.
+     * @param row The row to remove.
+     * @post The last row has been moved into row, and there is one row fewer.
+     */
+    void removeAt(std::size_t row);
+
+    /**
+     * Removes rows in one stable pass, the way DynamicArrayBag::removeIf removes slots.
+     * @param removed One flag per row; nonzero rows are removed.
+     * @post The remaining rows keep their order.
+     */
+    void compact(const std::vector<char>& removed);
+
+    /**
+     * Re-reads the fields of the dish in a row, after the dish was changed in place.
+     */
+    void refresh(std::size_t row, const Dish* dish);
+
+    int prepTime(std::size_t row) const;
+    Dish::CuisineType cuisineType(std::size_t row) const;
+    bool isElaborate(std::size_t row) const;
+    std::uint8_t allergens(std::size_t row) const;
+
+    /**
+     * @return The requests the row's dish satisfied when it was last read, as a Dish request mask.
+     */
+    std::uint8_t dietaryProfile(std::size_t row) const;
+
+    /**
+     * @return The number of rows flagged elaborate.
+     */
+    int countElaborate() const;
+
+    /**
+     * @return The number of rows whose allergen mask shares no bit with allergens.
+     */
+    int countFreeOf(std::uint8_t allergens) const;
+
+    /**
+     * @param requests A Dish request mask, e.g. Dish::VEGAN | Dish::NUT_FREE.
+     * @return The number of rows that satisfy every request in the mask, counted with a word-wise
+     * AND of the request bitmaps and a popcount.
+     */
+    int countSatisfying(std::uint8_t requests) const;
+
+    /**
+     * @param requests A Dish request mask.
+     * @return The rows that satisfy every request in the mask, in increasing order.
+     */
+    std::vector<int> rowsSatisfying(std::uint8_t requests) const;
+
+private:
+    std::vector<int> prep_times_;
+    std::vector<std::uint8_t> cuisine_types_;
+    std::vector<std::uint8_t> elaborate_;
+    std::vector<std::uint8_t> allergens_;
+
+    // Bitmap i has bit r set when row r satisfies request bit i; bits past the last row stay 0
+    static const int REQUEST_BITS = 6;
+    std::vector<std::uint64_t> dietary_[REQUEST_BITS];
+
+    void setDietaryProfile(std::size_t row, std::uint8_t profile);
+    template <class Visitor>
+    void forEachSatisfyingWord(std::uint8_t requests, Visitor visit) const;
+};
+
+#endif // DISHCOLUMNS_HPP
@@ -0,0 +1,148 @@
+/**
+ * @file DishParser.cpp
+ * @brief This file contains the implementation of the CSV record parser used by the Kitchen loaders.
+ *
+ * Every field is cut out of the row as a std::string_view and numbers are read with std::from_chars,
+ * so tokenizing a row performs no allocations. Strings are only copied when a dish keeps them.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "DishParser.hpp"
+#include "EnumTables.hpp"
+#include <charconv>
+
+namespace {
+
+/**
+ * Cuts the next field off the front of rest.
+ * @return The text before the first delimiter (or all of rest if there is none).
+ * @post rest holds the text after the delimiter, or is empty.
+ */
+std::string_view nextField(std::string_view& rest, char delim) {
+    size_t pos = rest.find(delim);
+    std::string_view field = rest.substr(0, pos);
+    rest = (pos == std::string_view::npos) ? std::string_view() : rest.substr(pos + 1);
+    return field;
+}
+
+bool parseInt(std::string_view field, int& value) {
+    auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+    return result.ec == std::errc();
+}
+
+bool parseDouble(std::string_view field, double& value) {
+    auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+    return result.ec == std::errc();
+}
+
+} // namespace
+
+bool parseDishRecord(std::string_view line, DishRecord& record) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    std::string_view rest = line;
+
+    int kind = DISH_KIND_TABLE.find(nextField(rest, ','));
+    if (kind < 0) {
+        return false;
+    }
+    record.kind = static_cast<DishRecord::Kind>(kind);
+
+    record.name = nextField(rest, ',');
+    record.ingredients = nextField(rest, ',');
+    if (!parseInt(nextField(rest, ','), record.prep_time)) {
+        return false;
+    }
+    if (!parseDouble(nextField(rest, ','), record.price)) {
+        return false;
+    }
+    record.cuisine_type = parseEnum(CUISINE_TYPE_TABLE, nextField(rest, ','), Dish::OTHER);
+
+    // The rest of the row is the ';'-separated AdditionalAttributes column
+    switch (record.kind) {
+        case DishRecord::APPETIZER:
+            record.serving_style = parseEnum(SERVING_STYLE_TABLE, nextField(rest, ';'), Appetizer::PLATED);
+            if (!parseInt(nextField(rest, ';'), record.spiciness_level)) {
+                return false;
+            }
+            record.vegetarian = (rest == "true");
+            break;
+        case DishRecord::MAINCOURSE:
+            record.cooking_method = parseEnum(COOKING_METHOD_TABLE, nextField(rest, ';'), MainCourse::GRILLED);
+            record.protein_type = nextField(rest, ';');
+            record.side_dishes = nextField(rest, ';');
+            record.gluten_free = (rest == "true");
+            break;
+        case DishRecord::DESSERT:
+            record.flavor_profile = parseEnum(FLAVOR_PROFILE_TABLE, nextField(rest, ';'), Dessert::SWEET);
+            if (!parseInt(nextField(rest, ';'), record.sweetness_level)) {
+                return false;
+            }
+            record.contains_nuts = (rest == "true");
+            break;
+    }
+    return true;
+}
+
+std::vector<std::string> splitIngredients(std::string_view list) {
+    std::vector<std::string> ingredients;
+    while (!list.empty()) {
+        std::string_view ingredient = nextField(list, ';');
+        ingredients.emplace_back(ingredient);
+    }
+    return ingredients;
+}
+
+Dish::IngredientList internIngredients(std::string_view list) {
+    IngredientPool& pool = IngredientPool::global();
+    Dish::IngredientList ingredients;
+    while (!list.empty()) {
+        ingredients.push_back(pool.intern(nextField(list, ';')));
+    }
+    return ingredients;
+}
+
+MainCourse::SideDishList splitSideDishes(std::string_view list) {
+    MainCourse::SideDishList side_dishes;
+    while (!list.empty()) {
+        std::string_view side = nextField(list, '|');
+        MainCourse::SideDish side_dish;
+        side_dish.name = std::string(nextField(side, ':'));
+        side_dish.category = parseEnum(SIDE_CATEGORY_TABLE, side, MainCourse::GRAIN);
+        side_dishes.push_back(std::move(side_dish));
+    }
+    return side_dishes;
+}
+
+Appetizer makeAppetizer(const DishRecord& record) {
+    Appetizer appetizer(std::string(record.name), {}, record.prep_time, record.price,
+                        record.cuisine_type, record.serving_style, record.spiciness_level, record.vegetarian);
+    appetizer.setIngredientIds(internIngredients(record.ingredients));
+    return appetizer;
+}
+
+MainCourse makeMainCourse(const DishRecord& record) {
+    MainCourse main_course(std::string(record.name), {}, record.prep_time, record.price,
+                           record.cuisine_type, record.cooking_method, std::string(record.protein_type),
+                           splitSideDishes(record.side_dishes), record.gluten_free);
+    main_course.setIngredientIds(internIngredients(record.ingredients));
+    return main_course;
+}
+
+Dessert makeDessert(const DishRecord& record) {
+    Dessert dessert(std::string(record.name), {}, record.prep_time, record.price,
+                    record.cuisine_type, record.flavor_profile, record.sweetness_level, record.contains_nuts);
+    dessert.setIngredientIds(internIngredients(record.ingredients));
+    return dessert;
+}
+
+Dish* createDish(const DishRecord& record) {
+    switch (record.kind) {
+        case DishRecord::APPETIZER: return new Appetizer(makeAppetizer(record));
+        case DishRecord::MAINCOURSE: return new MainCourse(makeMainCourse(record));
+        case DishRecord::DESSERT: return new Dessert(makeDessert(record));
+    }
+    return nullptr;
+}
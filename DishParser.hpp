@@ -0,0 +1,98 @@
+/**
+ * @file DishParser.hpp
+ * @brief This file contains the interface of the CSV record parser used by the Kitchen loaders.
+ *
+ * A row of a menu file is tokenized in a single pass into a DishRecord whose string fields are
+ * views into the row itself, so nothing is allocated until a dish is actually built from it.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef DISHPARSER_HPP
+#define DISHPARSER_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct DishRecord
+ * @brief One parsed row of a menu file.
+ * The string_view members point into the parsed line and are only valid while it is alive.
+ */
+struct DishRecord {
+    /**
+     * @enum Kind
+     * @brief The DishType column of the row.
+     */
+    enum Kind { APPETIZER, MAINCOURSE, DESSERT };
+
+    Kind kind = APPETIZER;
+    std::string_view name;
+    std::string_view ingredients; ///< ';'-separated ingredient list, split when the dish is built.
+    int prep_time = 0;
+    double price = 0.0;
+    Dish::CuisineType cuisine_type = Dish::OTHER;
+
+    // APPETIZER attributes
+    Appetizer::ServingStyle serving_style = Appetizer::PLATED;
+    int spiciness_level = 0;
+    bool vegetarian = false;
+
+    // MAINCOURSE attributes
+    MainCourse::CookingMethod cooking_method = MainCourse::GRILLED;
+    std::string_view protein_type;
+    std::string_view side_dishes; ///< '|'-separated list of "name:CATEGORY" pairs.
+    bool gluten_free = false;
+
+    // DESSERT attributes
+    Dessert::FlavorProfile flavor_profile = Dessert::SWEET;
+    int sweetness_level = 0;
+    bool contains_nuts = false;
+};
+
+/**
+ * Tokenizes one CSV row in a single pass.
+ * @param line The row, without its line terminator (a trailing '\r' is ignored).
+ * @param record The record to fill in.
+ * @return True if the row is a well-formed APPETIZER, MAINCOURSE or DESSERT row, false otherwise.
+ */
+bool parseDishRecord(std::string_view line, DishRecord& record);
+
+/**
+ * @param list A ';'-separated ingredient list.
+ * @return The ingredients as owned strings.
+ */
+std::vector<std::string> splitIngredients(std::string_view list);
+
+/**
+ * @param list A ';'-separated ingredient list.
+ * @return The ingredients interned in IngredientPool::global(), without building a string per ingredient.
+ */
+Dish::IngredientList internIngredients(std::string_view list);
+
+/**
+ * @param list A '|'-separated list of "name:CATEGORY" side dishes.
+ * @return The parsed side dishes.
+ */
+MainCourse::SideDishList splitSideDishes(std::string_view list);
+
+/**
+ * Builds the dish described by an APPETIZER / MAINCOURSE / DESSERT record.
+ * @pre record.kind matches the function that is called.
+ */
+Appetizer makeAppetizer(const DishRecord& record);
+MainCourse makeMainCourse(const DishRecord& record);
+Dessert makeDessert(const DishRecord& record);
+
+/**
+ * @param record A parsed row.
+ * @return A dynamically allocated dish of the record's type. The caller owns it.
+ */
+Dish* createDish(const DishRecord& record);
+
+#endif // DISHPARSER_HPP
@@ -0,0 +1,279 @@
+/*
+DynamicArrayBag implementation
+A variant of ArrayBag whose items_ array grows on demand instead of stopping at a fixed capacity.
+*/
+
+
+#include "DynamicArrayBag.hpp"
+#include <utility>
+
+/** default constructor**/
+template<class ItemType>
+DynamicArrayBag<ItemType>::DynamicArrayBag(): items_(nullptr), item_count_(0), capacity_(0)
+{
+}  // end default constructor
+
+/** copy constructor**/
+template<class ItemType>
+DynamicArrayBag<ItemType>::DynamicArrayBag(const DynamicArrayBag<ItemType>& other)
+   : items_(nullptr), item_count_(0), capacity_(0)
+{
+   reserve(other.item_count_);
+   for (int i = 0; i < other.item_count_; i++)
+   {
+      items_[i] = other.items_[i];
+   }
+   item_count_ = other.item_count_;
+}  // end copy constructor
+
+/** copy assignment**/
+template<class ItemType>
+DynamicArrayBag<ItemType>& DynamicArrayBag<ItemType>::operator=(const DynamicArrayBag<ItemType>& other)
+{
+   if (this != &other)
+   {
+      DynamicArrayBag<ItemType> copy(other);
+      std::swap(items_, copy.items_);
+      std::swap(item_count_, copy.item_count_);
+      std::swap(capacity_, copy.capacity_);
+   }  // end if
+   return *this;
+}  // end operator=
+
+/** destructor**/
+template<class ItemType>
+DynamicArrayBag<ItemType>::~DynamicArrayBag()
+{
+   delete[] items_;
+}  // end destructor
+
+/**
+ @return item_count_ : the current size of the bag
+ **/
+template<class ItemType>
+int DynamicArrayBag<ItemType>::getCurrentSize() const
+{
+	return item_count_;
+}  // end getCurrentSize
+
+/**
+ @return true if item_count_ == 0, false otherwise
+ **/
+template<class ItemType>
+bool DynamicArrayBag<ItemType>::isEmpty() const
+{
+	return item_count_ == 0;
+}  // end isEmpty
+
+/**
+ @return true if new_entry was successfully added to items_, false otherwise
+ **/
+template<class ItemType>
+bool DynamicArrayBag<ItemType>::add(const ItemType& new_entry)
+{
+   if (contains(new_entry)) {
+       return false;
+   }
+   if (item_count_ == capacity_)
+   {
+      // Doubling keeps the amortized cost of add constant
+      reallocate(capacity_ < MIN_CAPACITY ? MIN_CAPACITY : capacity_ * 2);
+   }  // end if
+   items_[item_count_] = new_entry;
+   item_count_++;
+   return true;
+}  // end add
+
+/**
+ @return true if an_entry was successfully removed from items_, false otherwise
+ **/
+template<class ItemType>
+bool DynamicArrayBag<ItemType>::remove(const ItemType& an_entry)
+{
+   int found_index = getIndexOf(an_entry);
+	bool can_remove = !isEmpty() && (found_index > -1);
+	if (can_remove)
+	{
+		item_count_--;
+		items_[found_index] = items_[item_count_];
+	}  // end if
+
+	return can_remove;
+}  // end remove
+
+/**
+ @post item_count_ == 0
+ **/
+template<class ItemType>
+void DynamicArrayBag<ItemType>::clear()
+{
+	item_count_ = 0;
+}  // end clear
+
+/**
+ @return the number of times an_entry is found in items_
+ **/
+template<class ItemType>
+int DynamicArrayBag<ItemType>::getFrequencyOf(const ItemType& an_entry) const
+{
+   int frequency = 0;
+   int curr_index = 0;       // Current array index
+   while (curr_index < item_count_)
+   {
+      if (items_[curr_index] == an_entry)
+      {
+         frequency++;
+      }  // end if
+
+      curr_index++;          // Increment to next entry
+   }  // end while
+
+   return frequency;
+}  // end getFrequencyOf
+
+/**
+ @return true if an_entry is found in items_, false otherwise
+ **/
+template<class ItemType>
+bool DynamicArrayBag<ItemType>::contains(const ItemType& an_entry) const
+{
+	return getIndexOf(an_entry) > -1;
+}  // end contains
+
+/**
+ @return capacity_ : the number of items the bag can hold before it reallocates
+ **/
+template<class ItemType>
+int DynamicArrayBag<ItemType>::getCapacity() const
+{
+   return capacity_;
+}  // end getCapacity
+
+/**
+ @post capacity_ >= new_capacity
+ **/
+template<class ItemType>
+void DynamicArrayBag<ItemType>::reserve(int new_capacity)
+{
+   if (new_capacity > capacity_)
+   {
+      reallocate(new_capacity);
+   }  // end if
+}  // end reserve
+
+/**
+ @post capacity_ == item_count_
+ **/
+template<class ItemType>
+void DynamicArrayBag<ItemType>::shrink_to_fit()
+{
+   if (capacity_ > item_count_)
+   {
+      reallocate(item_count_);
+   }  // end if
+}  // end shrink_to_fit
+
+/**
+ @return the removed items, in the order they were in
+ **/
+template<class ItemType>
+template<class Predicate>
+std::vector<ItemType> DynamicArrayBag<ItemType>::removeIf(Predicate pred)
+{
+   std::vector<ItemType> removed;
+   int keep_count = 0;
+   for (int i = 0; i < item_count_; i++)
+   {
+      if (pred(items_[i]))
+      {
+         removed.push_back(items_[i]);
+      }
+      else
+      {
+         if (keep_count != i)
+         {
+            items_[keep_count] = std::move(items_[i]);
+         }  // end if
+         keep_count++;
+      }  // end if
+   }  // end for
+   item_count_ = keep_count;
+   return removed;
+}  // end removeIf
+
+/**
+ @return an iterator to the first item
+ **/
+template<class ItemType>
+typename DynamicArrayBag<ItemType>::iterator DynamicArrayBag<ItemType>::begin()
+{
+   return items_;
+}  // end begin
+
+template<class ItemType>
+typename DynamicArrayBag<ItemType>::const_iterator DynamicArrayBag<ItemType>::begin() const
+{
+   return items_;
+}  // end begin
+
+/**
+ @return an iterator one past the last live item
+ **/
+template<class ItemType>
+typename DynamicArrayBag<ItemType>::iterator DynamicArrayBag<ItemType>::end()
+{
+   return items_ + item_count_;
+}  // end end
+
+template<class ItemType>
+typename DynamicArrayBag<ItemType>::const_iterator DynamicArrayBag<ItemType>::end() const
+{
+   return items_ + item_count_;
+}  // end end
+
+// ********* PRIVATE METHODS **************//
+
+/**
+	@param target to be found in items_
+ 	@return either the index target in the array items_ or -1,
+ 	if the array does not containthe target.
+ **/
+template<class ItemType>
+int DynamicArrayBag<ItemType>::getIndexOf(const ItemType& target) const
+{
+	bool found = false;
+  int result = -1;
+  int search_index = 0;
+   // If the bag is empty, item_count_ is zero, so loop is skipped
+   while (!found && (search_index < item_count_))
+   {
+
+      if (items_[search_index] == target)
+      {
+         found = true;
+         result = search_index;
+      }
+      else
+      {
+         search_index++;
+      }  // end if
+   }  // end while
+
+   return result;
+}  // end getIndexOf
+
+/**
+	@post items_ has been moved to a new array of length new_capacity
+ **/
+template<class ItemType>
+void DynamicArrayBag<ItemType>::reallocate(int new_capacity)
+{
+   ItemType* new_items = (new_capacity > 0) ? new ItemType[new_capacity] : nullptr;
+   for (int i = 0; i < item_count_; i++)
+   {
+      new_items[i] = std::move(items_[i]);
+   }  // end for
+   delete[] items_;
+   items_ = new_items;
+   capacity_ = new_capacity;
+}  // end reallocate
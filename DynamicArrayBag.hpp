@@ -0,0 +1,126 @@
+/*
+DynamicArrayBag interface
+A variant of ArrayBag whose items_ array grows on demand instead of stopping at a fixed capacity.
+*/
+
+#ifndef DYNAMIC_ARRAY_BAG_
+#define DYNAMIC_ARRAY_BAG_
+#include <iostream>
+#include <vector>
+
+template <class ItemType>
+class DynamicArrayBag
+{
+
+   public:
+   typedef ItemType *iterator;             // random-access iterator over the live items
+   typedef const ItemType *const_iterator;
+
+   /** default constructor, allocates nothing until the first add**/
+   DynamicArrayBag();
+
+   /** copy constructor, copies the items into an array sized to fit them**/
+   DynamicArrayBag(const DynamicArrayBag<ItemType> &other);
+
+   /** copy assignment**/
+   DynamicArrayBag<ItemType> &operator=(const DynamicArrayBag<ItemType> &other);
+
+   /** destructor, releases items_**/
+   ~DynamicArrayBag();
+
+   /**
+       @return item_count_ : the current size of the bag
+   **/
+   int getCurrentSize() const;
+
+   /**
+       @return true if item_count_ == 0, false otherwise
+   **/
+   bool isEmpty() const;
+
+   /**
+       @return true if new_entry was successfully added to items_, false otherwise
+       @post if items_ was full it has been reallocated with twice the capacity
+   **/
+   bool add(const ItemType &new_entry);
+
+   /**
+       @return true if an_entry was successfully removed from items_, false otherwise
+      **/
+   bool remove(const ItemType &an_entry);
+
+   /**
+       @post item_count_ == 0, the capacity is unchanged
+      **/
+   void clear();
+
+   /**
+       @return true if an_entry is found in items_, false otherwise
+      **/
+   bool contains(const ItemType &an_entry) const;
+
+   /**
+       @return the number of times an_entry is found in items_
+   **/
+   int getFrequencyOf(const ItemType &an_entry) const;
+
+   /**
+       @return an iterator to the first item, for range-for loops and standard algorithms
+   **/
+   iterator begin();
+   const_iterator begin() const;
+
+   /**
+       @return an iterator one past the last live item (items_ + item_count_)
+   **/
+   iterator end();
+   const_iterator end() const;
+
+   /**
+       @return capacity_ : the number of items the bag can hold before it reallocates
+   **/
+   int getCapacity() const;
+
+   /**
+       @param new_capacity the number of items the bag should be able to hold
+       @post capacity_ >= new_capacity
+   **/
+   void reserve(int new_capacity);
+
+   /**
+       @post capacity_ == item_count_, releasing the unused part of items_
+   **/
+   void shrink_to_fit();
+
+   /**
+       Removes every item for which pred returns true in one stable compaction pass.
+       @param pred called once per item, in slot order
+       @return the removed items, in the order they were in
+       @post the remaining items keep their relative order
+   **/
+   template <class Predicate>
+   std::vector<ItemType> removeIf(Predicate pred);
+
+   protected:
+   static const int MIN_CAPACITY = 16; // first allocation made by add
+   ItemType *items_;                   // Array of bag items
+   int item_count_;                    // Current count of bag items
+   int capacity_;                      // Allocated length of items_
+
+   /**
+       @param target to be found in items_
+      @return either the index target in the array items_ or -1,
+      if the array does not contain the target.
+      **/
+   int getIndexOf(const ItemType &target) const;
+
+   /**
+       @param new_capacity the length of the new items_ array, at least item_count_
+       @post items_ has been moved to a new array of length new_capacity
+      **/
+   void reallocate(int new_capacity);
+
+}; // end DynamicArrayBag
+
+#include "DynamicArrayBag.cpp"
+#endif
@@ -0,0 +1,154 @@
+/**
+ * @file EnumTables.hpp
+ * @brief This file contains the constexpr string tables for every enum used by the dishes.
+ *
+ * Each table holds the CSV spelling and the display() spelling of every enumerator, indexed by
+ * the enumerator's value, plus a perfect hash over the CSV spellings that is searched for at
+ * compile time. Parsing a field is one hash, one table load and one string compare.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef ENUMTABLES_HPP
+#define ENUMTABLES_HPP
+
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "DishParser.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Seeded FNV-1a hash used by the perfect-hash tables.
+ */
+constexpr std::uint32_t enumHash(std::string_view s, std::uint32_t seed) {
+    std::uint32_t h = 2166136261u ^ seed;
+    for (char c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    return h ^ (h >> 15);
+}
+
+/**
+ * @struct EnumTable
+ * @brief The names, display labels and perfect-hash slots of one enum with N enumerators.
+ */
+template <std::size_t N>
+struct EnumTable {
+    static constexpr std::size_t SLOT_COUNT = 32; ///< Power of two, at least 2 * N.
+    static constexpr std::uint32_t MAX_SEED = 1 << 16;
+
+    std::array<std::string_view, N> names;  ///< CSV / report spelling, e.g. "FAMILY_STYLE".
+    std::array<std::string_view, N> labels; ///< display() spelling, e.g. "Family Style".
+    std::uint32_t seed = MAX_SEED;          ///< Seed that makes enumHash collision-free over names.
+    std::array<signed char, SLOT_COUNT> slots{};
+
+    /**
+     * @return True if a collision-free seed was found.
+     */
+    constexpr bool valid() const {
+        return seed < MAX_SEED;
+    }
+
+    /**
+     * @param s A CSV spelling.
+     * @return The enumerator value spelled s, or -1 if s is not one of the names.
+     */
+    constexpr int find(std::string_view s) const {
+        int index = slots[enumHash(s, seed) % SLOT_COUNT];
+        return (index >= 0 && names[index] == s) ? index : -1;
+    }
+};
+
+/**
+ * Builds a table, searching for the first seed under which every name hashes to its own slot.
+ */
+template <std::size_t N>
+constexpr EnumTable<N> makeEnumTable(const std::array<std::string_view, N>& names,
+                                     const std::array<std::string_view, N>& labels) {
+    static_assert(2 * N <= EnumTable<N>::SLOT_COUNT, "enum has too many values for its table");
+    EnumTable<N> table{names, labels};
+    for (std::uint32_t seed = 0; seed < EnumTable<N>::MAX_SEED; ++seed) {
+        for (signed char& slot : table.slots) {
+            slot = -1;
+        }
+        bool collision = false;
+        for (std::size_t i = 0; i < N && !collision; ++i) {
+            signed char& slot = table.slots[enumHash(names[i], seed) % EnumTable<N>::SLOT_COUNT];
+            collision = (slot != -1);
+            slot = static_cast<signed char>(i);
+        }
+        if (!collision) {
+            table.seed = seed;
+            return table;
+        }
+    }
+    return table;
+}
+
+inline constexpr EnumTable<7> CUISINE_TYPE_TABLE = makeEnumTable<7>(
+    {"ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"},
+    {"ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"});
+
+inline constexpr EnumTable<3> SERVING_STYLE_TABLE = makeEnumTable<3>(
+    {"PLATED", "FAMILY_STYLE", "BUFFET"},
+    {"Plated", "Family Style", "Buffet"});
+
+inline constexpr EnumTable<6> COOKING_METHOD_TABLE = makeEnumTable<6>(
+    {"GRILLED", "BAKED", "BOILED", "FRIED", "STEAMED", "RAW"},
+    {"Grilled", "Baked", "Boiled", "Fried", "Steamed", "Raw"});
+
+inline constexpr EnumTable<8> SIDE_CATEGORY_TABLE = makeEnumTable<8>(
+    {"GRAIN", "PASTA", "LEGUME", "BREAD", "SALAD", "SOUP", "STARCHES", "VEGETABLE"},
+    {"Grain", "Pasta", "Legume", "Bread", "Salad", "Soup", "Starches", "Vegetable"});
+
+inline constexpr EnumTable<5> FLAVOR_PROFILE_TABLE = makeEnumTable<5>(
+    {"SWEET", "BITTER", "SOUR", "SALTY", "UMAMI"},
+    {"Sweet", "Bitter", "Sour", "Salty", "Umami"});
+
+inline constexpr EnumTable<3> DISH_KIND_TABLE = makeEnumTable<3>(
+    {"APPETIZER", "MAINCOURSE", "DESSERT"},
+    {"Appetizer", "Main Course", "Dessert"});
+
+static_assert(CUISINE_TYPE_TABLE.valid() && SERVING_STYLE_TABLE.valid() && COOKING_METHOD_TABLE.valid() &&
+              SIDE_CATEGORY_TABLE.valid() && FLAVOR_PROFILE_TABLE.valid() && DISH_KIND_TABLE.valid(),
+              "no perfect hash seed found");
+
+// The tables are indexed by enumerator value, so the enums must stay dense and in this order
+static_assert(Dish::OTHER == 6 && Appetizer::BUFFET == 2 && MainCourse::RAW == 5 &&
+              MainCourse::VEGETABLE == 7 && Dessert::UMAMI == 4 && DishRecord::DESSERT == 2,
+              "enum tables are out of date");
+
+/**
+ * @param table The table of E.
+ * @param s A CSV spelling.
+ * @param fallback The value returned when s is not a name in the table.
+ * @return The enumerator spelled s.
+ */
+template <class E, std::size_t N>
+constexpr E parseEnum(const EnumTable<N>& table, std::string_view s, E fallback) {
+    int index = table.find(s);
+    return index < 0 ? fallback : static_cast<E>(index);
+}
+
+/**
+ * @return The CSV / report spelling of value.
+ */
+template <class E, std::size_t N>
+constexpr std::string_view enumName(const EnumTable<N>& table, E value) {
+    return table.names[static_cast<std::size_t>(value)];
+}
+
+/**
+ * @return The display() spelling of value.
+ */
+template <class E, std::size_t N>
+constexpr std::string_view enumLabel(const EnumTable<N>& table, E value) {
+    return table.labels[static_cast<std::size_t>(value)];
+}
+
+#endif // ENUMTABLES_HPP
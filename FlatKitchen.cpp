@@ -0,0 +1,175 @@
+/**
+ * @file FlatKitchen.cpp
+ * @brief This file contains the implementation of the FlatKitchen class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "FlatKitchen.hpp"
+#include "DishParser.hpp"
+#include "MappedFile.hpp"
+#include "EnumTables.hpp"
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+
+FlatKitchen::FlatKitchen() : total_prep_time_(0), count_elaborate_(0)
+{
+}
+
+FlatKitchen::FlatKitchen(const std::string& filename) : FlatKitchen()
+{
+    load(filename);
+}
+
+const Dish& FlatKitchen::asDish(const FlatDish& dish)
+{
+    return std::visit([](const Dish& base) -> const Dish& { return base; }, dish);
+}
+
+bool FlatKitchen::load(const std::string& filename)
+{
+    MappedFile file(filename);
+    if (!file.isOpen())
+    {
+        std::cout << "Error opening the file!";
+        return false;
+    }
+
+    std::string_view rest = file.contents();
+    bool header = true;
+    DishRecord record;
+    while (!rest.empty())
+    {
+        size_t end = rest.find('\n');
+        std::string_view line = rest.substr(0, end);
+        rest = (end == std::string_view::npos) ? std::string_view() : rest.substr(end + 1);
+        if (header)
+        {
+            header = false;
+            continue;
+        }
+        if (!parseDishRecord(line, record))
+        {
+            continue;
+        }
+        switch (record.kind)
+        {
+            case DishRecord::APPETIZER: newOrder(makeAppetizer(record)); break;
+            case DishRecord::MAINCOURSE: newOrder(makeMainCourse(record)); break;
+            case DishRecord::DESSERT: newOrder(makeDessert(record)); break;
+        }
+    }
+    return true;
+}
+
+void FlatKitchen::newOrder(FlatDish dish)
+{
+    const Dish& base = asDish(dish);
+    total_prep_time_ += base.getPrepTime();
+    count_elaborate_ += base.isElaborate();
+    dishes_.push_back(std::move(dish));
+}
+
+void FlatKitchen::reserve(std::size_t capacity)
+{
+    dishes_.reserve(capacity);
+}
+
+int FlatKitchen::getCurrentSize() const
+{
+    return dishes_.size();
+}
+
+const std::vector<FlatKitchen::FlatDish>& FlatKitchen::getDishes() const
+{
+    return dishes_;
+}
+
+int FlatKitchen::getPrepTimeSum() const
+{
+    return total_prep_time_;
+}
+
+int FlatKitchen::calculateAvgPrepTime() const
+{
+    if (dishes_.empty())
+    {
+        return 0;
+    }
+    return round(double(total_prep_time_) / dishes_.size());
+}
+
+int FlatKitchen::elaborateDishCount() const
+{
+    return count_elaborate_;
+}
+
+double FlatKitchen::calculateElaboratePercentage() const
+{
+    if (dishes_.empty() || count_elaborate_ == 0)
+    {
+        return 0;
+    }
+    return round(double(count_elaborate_) / double(dishes_.size()) * 10000) / 100;
+}
+
+int FlatKitchen::tallyCuisineTypes(const std::string& cuisine_type) const
+{
+    int type = CUISINE_TYPE_TABLE.find(cuisine_type);
+    if (type < 0)
+    {
+        return 0;
+    }
+    int count = 0;
+    for (const FlatDish& dish : dishes_)
+    {
+        count += asDish(dish).getCuisineTypeEnum() == type;
+    }
+    return count;
+}
+
+int FlatKitchen::releaseDishesBelowPrepTime(const int& prep_time)
+{
+    return releaseIf([prep_time](const Dish& dish) { return dish.getPrepTime() < prep_time; });
+}
+
+int FlatKitchen::releaseDishesOfCuisineType(const std::string& cuisine_type)
+{
+    int type = CUISINE_TYPE_TABLE.find(cuisine_type);
+    if (type < 0)
+    {
+        return 0;
+    }
+    return releaseIf([type](const Dish& dish) { return dish.getCuisineTypeEnum() == type; });
+}
+
+void FlatKitchen::kitchenReport() const
+{
+    for (std::string_view cuisine_type : CUISINE_TYPE_TABLE.names)
+    {
+        std::cout << cuisine_type << ": " << tallyCuisineTypes(std::string(cuisine_type)) << std::endl;
+    }
+    std::cout << std::endl;
+    std::cout << "AVERAGE PREP TIME: " << calculateAvgPrepTime() << std::endl;
+    std::cout << "ELABORATE DISHES: " << calculateElaboratePercentage() << "%" << std::endl;
+}
+
+void FlatKitchen::dietaryAdjustment(Dish::DietaryRequest request)
+{
+    count_elaborate_ = 0;
+    forEach([this, &request](auto& dish) {
+        using Type = std::decay_t<decltype(dish)>;
+        dish.Type::dietaryAccommodations(request); // Qualified, so the call is direct and can be inlined
+        count_elaborate_ += dish.isElaborate();
+    });
+}
+
+void FlatKitchen::displayMenu() const
+{
+    forEach([](const auto& dish) {
+        using Type = std::decay_t<decltype(dish)>;
+        dish.Type::display();
+        std::cout << std::endl;
+    });
+}
@@ -0,0 +1,155 @@
+/**
+ * @file FlatKitchen.hpp
+ * @brief This file contains the interface of the FlatKitchen class, a kitchen that stores its
+ * dishes by value in one contiguous array.
+ *
+ * Each element is a std::variant<Appetizer, MainCourse, Dessert>, and every operation dispatches
+ * with std::visit to a statically known type. Bulk loops therefore make no virtual calls and walk
+ * memory in order, instead of following Dish* to objects spread over the heap.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef FLATKITCHEN_HPP
+#define FLATKITCHEN_HPP
+
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include <cstddef>
+#include <string>
+#include <variant>
+#include <vector>
+
+class FlatKitchen {
+    public:
+        typedef std::variant<Appetizer, MainCourse, Dessert> FlatDish;
+
+        FlatKitchen();
+
+        /**
+        * Parameterized constructor.
+        * @param filename The name of the input CSV file containing dish information.
+        * @post Initializes the kitchen by reading dishes from the CSV file.
+        */
+        explicit FlatKitchen(const std::string& filename);
+
+        /**
+        * Reads dishes from a CSV file and appends them in file order.
+        * @param filename The name of the input CSV file containing dish information.
+        * @return True if the file was read, false if it could not be opened.
+        */
+        bool load(const std::string& filename);
+
+        /**
+        * Appends a dish by value.
+        * @post The prep time sum and elaborate count include the dish.
+        */
+        void newOrder(FlatDish dish);
+
+        /**
+        * @param capacity The number of dishes the kitchen should hold without reallocating.
+        */
+        void reserve(std::size_t capacity);
+
+        int getCurrentSize() const;
+        const std::vector<FlatDish>& getDishes() const;
+
+        int getPrepTimeSum() const;
+        int calculateAvgPrepTime() const;
+        int elaborateDishCount() const;
+        double calculateElaboratePercentage() const;
+        int tallyCuisineTypes(const std::string& cuisine_type) const;
+
+        /**
+        * Removes every dish for which pred returns true, in one stable pass.
+        * @param pred Called as pred(const Dish&) once per dish, in kitchen order.
+        * @return The number of dishes removed.
+        */
+        template <class Predicate>
+        int releaseIf(Predicate pred);
+
+        int releaseDishesBelowPrepTime(const int& prep_time);
+        int releaseDishesOfCuisineType(const std::string& cuisine_type);
+
+        /**
+        * Prints the same report as Kitchen::kitchenReport().
+        */
+        void kitchenReport() const;
+
+        /**
+        * Adjusts every dish for the request, calling each type's dietaryAccommodations() directly.
+        * @post The elaborate count is recomputed, since removing ingredients can change it.
+        */
+        void dietaryAdjustment(Dish::DietaryRequest request);
+
+        /**
+        * Displays all dishes, in kitchen order, like Kitchen::displayMenu().
+        */
+        void displayMenu() const;
+
+        /**
+        * Calls fn(dish) for every dish with its concrete type (Appetizer&, MainCourse& or Dessert&).
+        */
+        template <class Fn>
+        void forEach(Fn fn);
+
+        template <class Fn>
+        void forEach(Fn fn) const;
+
+    private:
+        std::vector<FlatDish> dishes_;
+        int total_prep_time_;
+        int count_elaborate_;
+
+        /**
+        * @return The dish held by a variant, as its base class.
+        */
+        static const Dish& asDish(const FlatDish& dish);
+};
+
+template <class Predicate>
+int FlatKitchen::releaseIf(Predicate pred)
+{
+    size_t keep = 0;
+    for (size_t i = 0; i < dishes_.size(); i++)
+    {
+        const Dish& dish = asDish(dishes_[i]);
+        if (pred(dish))
+        {
+            total_prep_time_ -= dish.getPrepTime();
+            count_elaborate_ -= dish.isElaborate();
+        }
+        else
+        {
+            if (keep != i)
+            {
+                dishes_[keep] = std::move(dishes_[i]);
+            }
+            keep++;
+        }
+    }
+    int released = dishes_.size() - keep;
+    dishes_.erase(dishes_.begin() + keep, dishes_.end());
+    return released;
+}
+
+template <class Fn>
+void FlatKitchen::forEach(Fn fn)
+{
+    for (FlatDish& dish : dishes_)
+    {
+        std::visit(fn, dish);
+    }
+}
+
+template <class Fn>
+void FlatKitchen::forEach(Fn fn) const
+{
+    for (const FlatDish& dish : dishes_)
+    {
+        std::visit(fn, dish);
+    }
+}
+
+#endif // FLATKITCHEN_HPP
@@ -0,0 +1,245 @@
+/*
+IndexedArrayBag implementation
+The index uses linear probing with backward-shift deletion, so it never accumulates tombstones.
+*/
+
+
+#include "IndexedArrayBag.hpp"
+#include <cstdint>
+#include <utility>
+
+/** default constructor**/
+template<class ItemType, class Hash>
+IndexedArrayBag<ItemType, Hash>::IndexedArrayBag()
+   : DynamicArrayBag<ItemType>(), index_(nullptr), index_capacity_(0)
+{
+}  // end default constructor
+
+/** copy constructor**/
+template<class ItemType, class Hash>
+IndexedArrayBag<ItemType, Hash>::IndexedArrayBag(const IndexedArrayBag<ItemType, Hash>& other)
+   : DynamicArrayBag<ItemType>(other), index_(nullptr), index_capacity_(0), hash_(other.hash_)
+{
+   rebuildIndex(item_count_);
+}  // end copy constructor
+
+/** copy assignment**/
+template<class ItemType, class Hash>
+IndexedArrayBag<ItemType, Hash>& IndexedArrayBag<ItemType, Hash>::operator=(const IndexedArrayBag<ItemType, Hash>& other)
+{
+   if (this != &other)
+   {
+      DynamicArrayBag<ItemType>::operator=(other);
+      hash_ = other.hash_;
+      rebuildIndex(item_count_);
+   }  // end if
+   return *this;
+}  // end operator=
+
+/** destructor**/
+template<class ItemType, class Hash>
+IndexedArrayBag<ItemType, Hash>::~IndexedArrayBag()
+{
+   delete[] index_;
+}  // end destructor
+
+/**
+ @return true if new_entry was successfully added to items_, false otherwise
+ **/
+template<class ItemType, class Hash>
+bool IndexedArrayBag<ItemType, Hash>::add(const ItemType& new_entry)
+{
+   if (contains(new_entry)) {
+       return false;
+   }
+   if (item_count_ == capacity_)
+   {
+      this->reallocate(capacity_ < this->MIN_CAPACITY ? this->MIN_CAPACITY : capacity_ * 2);
+   }  // end if
+   if (2 * (item_count_ + 1) > index_capacity_)
+   {
+      rebuildIndex(item_count_ + 1);
+   }  // end if
+   items_[item_count_] = new_entry;
+   indexInsert(item_count_);
+   item_count_++;
+   return true;
+}  // end add
+
+/**
+ @return true if an_entry was successfully removed from items_, false otherwise
+ **/
+template<class ItemType, class Hash>
+bool IndexedArrayBag<ItemType, Hash>::remove(const ItemType& an_entry)
+{
+   int position = findIndexPosition(an_entry);
+   if (position < 0)
+   {
+      return false;
+   }  // end if
+   int found_index = index_[position];
+   indexErase(position);
+   item_count_--;
+   if (found_index != item_count_)
+   {
+      // Swap-with-last: the moved item's index entry now has to point at its new slot
+      int moved_position = findIndexPosition(items_[item_count_]);
+      items_[found_index] = items_[item_count_];
+      index_[moved_position] = found_index;
+   }  // end if
+   return true;
+}  // end remove
+
+/**
+ @post item_count_ == 0
+ **/
+template<class ItemType, class Hash>
+void IndexedArrayBag<ItemType, Hash>::clear()
+{
+   item_count_ = 0;
+   for (int i = 0; i < index_capacity_; i++)
+   {
+      index_[i] = EMPTY;
+   }  // end for
+}  // end clear
+
+/**
+ @return true if an_entry is found in items_, false otherwise
+ **/
+template<class ItemType, class Hash>
+bool IndexedArrayBag<ItemType, Hash>::contains(const ItemType& an_entry) const
+{
+   return findIndexPosition(an_entry) > -1;
+}  // end contains
+
+/**
+ @return the number of times an_entry is found in items_
+ **/
+template<class ItemType, class Hash>
+int IndexedArrayBag<ItemType, Hash>::getFrequencyOf(const ItemType& an_entry) const
+{
+   return contains(an_entry) ? 1 : 0;
+}  // end getFrequencyOf
+
+/**
+ @post both items_ and the index can hold new_capacity items without reallocating
+ **/
+template<class ItemType, class Hash>
+void IndexedArrayBag<ItemType, Hash>::reserve(int new_capacity)
+{
+   DynamicArrayBag<ItemType>::reserve(new_capacity);
+   if (2 * new_capacity > index_capacity_)
+   {
+      rebuildIndex(new_capacity);
+   }  // end if
+}  // end reserve
+
+/**
+ @return the removed items, in the order they were in
+ **/
+template<class ItemType, class Hash>
+template<class Predicate>
+std::vector<ItemType> IndexedArrayBag<ItemType, Hash>::removeIf(Predicate pred)
+{
+   std::vector<ItemType> removed = DynamicArrayBag<ItemType>::removeIf(pred);
+   if (!removed.empty())
+   {
+      // Most surviving items moved, so one rebuild beats patching entries one at a time
+      rebuildIndex(item_count_);
+   }  // end if
+   return removed;
+}  // end removeIf
+
+// ********* PRIVATE METHODS **************//
+
+/**
+	@param target to be found in items_
+ 	@return either the index target in the array items_ or -1,
+ 	if the array does not contain the target.
+ **/
+template<class ItemType, class Hash>
+int IndexedArrayBag<ItemType, Hash>::getIndexOf(const ItemType& target) const
+{
+   int position = findIndexPosition(target);
+   return position < 0 ? -1 : index_[position];
+}  // end getIndexOf
+
+template<class ItemType, class Hash>
+int IndexedArrayBag<ItemType, Hash>::findIndexPosition(const ItemType& target) const
+{
+   if (item_count_ == 0)
+   {
+      return -1;
+   }  // end if
+   int mask = index_capacity_ - 1;
+   for (int position = homePosition(target); index_[position] != EMPTY; position = (position + 1) & mask)
+   {
+      if (items_[index_[position]] == target)
+      {
+         return position;
+      }  // end if
+   }  // end for
+   return -1;
+}  // end findIndexPosition
+
+template<class ItemType, class Hash>
+int IndexedArrayBag<ItemType, Hash>::homePosition(const ItemType& key) const
+{
+   // Fibonacci hashing spreads keys whose hashes differ only in high bits (such as pointers)
+   std::uint64_t mixed = static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+   return static_cast<int>((mixed >> 32) & static_cast<std::uint64_t>(index_capacity_ - 1));
+}  // end homePosition
+
+template<class ItemType, class Hash>
+void IndexedArrayBag<ItemType, Hash>::indexInsert(int slot)
+{
+   int mask = index_capacity_ - 1;
+   int position = homePosition(items_[slot]);
+   while (index_[position] != EMPTY)
+   {
+      position = (position + 1) & mask;
+   }  // end while
+   index_[position] = slot;
+}  // end indexInsert
+
+template<class ItemType, class Hash>
+void IndexedArrayBag<ItemType, Hash>::indexErase(int position)
+{
+   int mask = index_capacity_ - 1;
+   int hole = position;
+   for (int next = (hole + 1) & mask; index_[next] != EMPTY; next = (next + 1) & mask)
+   {
+      // An entry can fill the hole only if its home is not in the cyclic range (hole, next]
+      int home = homePosition(items_[index_[next]]);
+      if (((next - home) & mask) >= ((next - hole) & mask))
+      {
+         index_[hole] = index_[next];
+         hole = next;
+      }  // end if
+   }  // end for
+   index_[hole] = EMPTY;
+}  // end indexErase
+
+template<class ItemType, class Hash>
+void IndexedArrayBag<ItemType, Hash>::rebuildIndex(int min_items)
+{
+   int needed = 16;
+   while (needed < 2 * min_items)
+   {
+      needed *= 2;
+   }  // end while
+   if (needed > index_capacity_)
+   {
+      delete[] index_;
+      index_ = new int[needed];
+      index_capacity_ = needed;
+   }  // end if
+   for (int i = 0; i < index_capacity_; i++)
+   {
+      index_[i] = EMPTY;
+   }  // end for
+   for (int slot = 0; slot < item_count_; slot++)
+   {
+      indexInsert(slot);
+   }  // end for
+}  // end rebuildIndex
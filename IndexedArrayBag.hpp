@@ -0,0 +1,118 @@
+/*
+IndexedArrayBag interface
+A DynamicArrayBag that also keeps an open-addressing hash index from each item to its slot in items_,
+so add, remove and contains run in expected O(1) while items_ stays a dense array.
+*/
+
+#ifndef INDEXED_ARRAY_BAG_
+#define INDEXED_ARRAY_BAG_
+#include "DynamicArrayBag.hpp"
+#include <cstddef>
+#include <functional>
+
+template <class ItemType, class Hash = std::hash<ItemType>>
+class IndexedArrayBag : public DynamicArrayBag<ItemType>
+{
+
+   public:
+   /** default constructor**/
+   IndexedArrayBag();
+
+   /** copy constructor, copies the items and rebuilds the index**/
+   IndexedArrayBag(const IndexedArrayBag<ItemType, Hash> &other);
+
+   /** copy assignment**/
+   IndexedArrayBag<ItemType, Hash> &operator=(const IndexedArrayBag<ItemType, Hash> &other);
+
+   /** destructor, releases the index**/
+   ~IndexedArrayBag();
+
+   /**
+       @return true if new_entry was successfully added to items_, false otherwise
+       @post new_entry is indexed at its slot
+   **/
+   bool add(const ItemType &new_entry);
+
+   /**
+       @return true if an_entry was successfully removed from items_, false otherwise
+       @post the last item has been moved into the freed slot and re-indexed there
+      **/
+   bool remove(const ItemType &an_entry);
+
+   /**
+       @post item_count_ == 0 and the index is empty
+      **/
+   void clear();
+
+   /**
+       @return true if an_entry is found in items_, false otherwise
+      **/
+   bool contains(const ItemType &an_entry) const;
+
+   /**
+       @return the number of times an_entry is found in items_ (0 or 1, since add rejects duplicates)
+   **/
+   int getFrequencyOf(const ItemType &an_entry) const;
+
+   /**
+       @param new_capacity the number of items the bag should be able to hold
+       @post both items_ and the index can hold new_capacity items without reallocating
+   **/
+   void reserve(int new_capacity);
+
+   /**
+       Removes every item for which pred returns true in one stable compaction pass.
+       @param pred called once per item, in slot order
+       @return the removed items, in the order they were in
+       @post the index is rebuilt once for the compacted items_
+   **/
+   template <class Predicate>
+   std::vector<ItemType> removeIf(Predicate pred);
+
+   protected:
+   using DynamicArrayBag<ItemType>::items_;
+   using DynamicArrayBag<ItemType>::item_count_;
+   using DynamicArrayBag<ItemType>::capacity_;
+
+   static const int EMPTY = -1;
+   int *index_;          // Open-addressing table of slots in items_, EMPTY where unused
+   int index_capacity_;  // Length of index_, a power of two at least twice item_count_
+   Hash hash_;
+
+   /**
+       @param target to be found in items_
+      @return either the index target in the array items_ or -1,
+      if the array does not contain the target.
+      **/
+   int getIndexOf(const ItemType &target) const;
+
+   /**
+       @return the position in index_ holding target's slot, or -1 if target is not in the bag
+      **/
+   int findIndexPosition(const ItemType &target) const;
+
+   /**
+       @return the preferred position of key in index_
+      **/
+   int homePosition(const ItemType &key) const;
+
+   /**
+       @post slot is indexed under the hash of items_[slot]
+      **/
+   void indexInsert(int slot);
+
+   /**
+       @post the entry at position is removed, shifting later entries of its probe run back
+      **/
+   void indexErase(int position);
+
+   /**
+       @param min_items the number of items the rebuilt index must be able to hold
+       @post index_ is reallocated if needed and every item is re-indexed at its slot
+      **/
+   void rebuildIndex(int min_items);
+
+}; // end IndexedArrayBag
+
+#include "IndexedArrayBag.cpp"
+#endif
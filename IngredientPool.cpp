@@ -0,0 +1,151 @@
+/**
+ * @file IngredientPool.cpp
+ * @brief This file contains the implementation of the IngredientPool class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "IngredientPool.hpp"
+#include <mutex>
+
+IngredientPool& IngredientPool::global() {
+    static IngredientPool pool;
+    return pool;
+}
+
+IngredientPool::IngredientPool() {
+    for (std::atomic<std::string*>& names : name_blocks_) {
+        names.store(nullptr, std::memory_order_relaxed);
+    }
+    for (std::string_view name : {"Meat", "Chicken", "Fish", "Beef", "Pork", "Lamb", "Shrimp", "Bacon"}) {
+        addToClass(name, MEAT);
+    }
+    for (std::string_view name : {"Milk", "Eggs", "Cheese", "Butter", "Cream", "Yogurt"}) {
+        addToClass(name, DAIRY_EGG);
+    }
+    for (std::string_view name : {"Wheat", "Flour", "Bread", "Pasta", "Barley", "Rye", "Oats", "Crust"}) {
+        addToClass(name, GLUTEN);
+    }
+    for (std::string_view name : {"Almonds", "Walnuts", "Pecans", "Hazelnuts", "Peanuts", "Cashews", "Pistachios"}) {
+        addToClass(name, NUTS);
+    }
+}
+
+IngredientPool::~IngredientPool() {
+    for (std::atomic<std::string*>& names : name_blocks_) {
+        delete[] names.load(std::memory_order_relaxed);
+    }
+}
+
+IngredientId IngredientPool::intern(std::string_view name) {
+    {
+        // Almost every lookup finds a name that is already there, so try under the shared lock first
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto found = ids_.find(name);
+        if (found != ids_.end()) {
+            return found->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    return internLocked(name); // Another thread may have added it in between, which internLocked handles
+}
+
+IngredientId IngredientPool::internLocked(std::string_view name) {
+    auto found = ids_.find(name);
+    if (found != ids_.end()) {
+        return found->second;
+    }
+    IngredientId id = static_cast<IngredientId>(size_.load(std::memory_order_relaxed));
+    int block;
+    std::size_t offset;
+    locate(id, block, offset);
+    std::string* names = name_blocks_[block].load(std::memory_order_relaxed);
+    if (names == nullptr) {
+        names = new std::string[FIRST_BLOCK_NAMES << block];
+        name_blocks_[block].store(names, std::memory_order_relaxed);
+    }
+    names[offset] = std::string(name);
+    classes_.push_back(0);
+    ids_.emplace(names[offset], id);
+    size_.store(id + 1, std::memory_order_release); // Publishes the block and the name to name()
+    return id;
+}
+
+void IngredientPool::locate(IngredientId id, int& block, std::size_t& offset) {
+    // Block b starts at id FIRST_BLOCK_NAMES * (2^b - 1)
+    std::size_t scaled = id / FIRST_BLOCK_NAMES + 1;
+    block = 63 - __builtin_clzll(scaled);
+    offset = id - FIRST_BLOCK_NAMES * ((std::size_t(1) << block) - 1);
+}
+
+std::vector<IngredientId> IngredientPool::internAll(std::initializer_list<std::string_view> names) {
+    std::vector<IngredientId> ids;
+    ids.reserve(names.size());
+    for (std::string_view name : names) {
+        ids.push_back(intern(name));
+    }
+    return ids;
+}
+
+const std::string& IngredientPool::name(IngredientId id) const {
+    // Pairs with the release store in internLocked, so the block pointer and the name are visible
+    size_.load(std::memory_order_acquire);
+    int block;
+    std::size_t offset;
+    locate(id, block, offset);
+    return name_blocks_[block].load(std::memory_order_relaxed)[offset];
+}
+
+std::size_t IngredientPool::size() const {
+    return size_.load(std::memory_order_acquire);
+}
+
+void IngredientPool::addToClass(std::string_view name, IngredientClass ingredient_class) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    IngredientId id = internLocked(name);
+    if (classes_[id] & ingredient_class) {
+        return;
+    }
+    classes_[id] |= ingredient_class;
+    class_generation_.fetch_add(1, std::memory_order_release);
+    for (int bit = 0; bit < CLASS_COUNT; bit++) {
+        if (ingredient_class == (1 << bit)) {
+            members_[bit].push_back(id);
+        }
+    }
+}
+
+std::uint8_t IngredientPool::classesOf(IngredientId id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return classes_[id];
+}
+
+std::uint8_t IngredientPool::classesOf(const IngredientId* first, const IngredientId* last) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::uint8_t classes = 0;
+    for (; first != last; ++first) {
+        classes |= classes_[*first];
+    }
+    return classes;
+}
+
+void IngredientPool::classesOfEach(const IngredientId* first, const IngredientId* last, std::uint8_t* classes) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (; first != last; ++first) {
+        *classes++ = classes_[*first];
+    }
+}
+
+std::uint32_t IngredientPool::classGeneration() const {
+    return class_generation_.load(std::memory_order_acquire);
+}
+
+std::vector<IngredientId> IngredientPool::membersOf(IngredientClass ingredient_class) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (int bit = 0; bit < CLASS_COUNT; bit++) {
+        if (ingredient_class == (1 << bit)) {
+            return members_[bit];
+        }
+    }
+    return {};
+}
@@ -0,0 +1,138 @@
+/**
+ * @file IngredientPool.hpp
+ * @brief This file contains the interface of the IngredientPool class, the process-wide symbol
+ * table that maps every distinct ingredient name to a compact 32-bit id.
+ *
+ * Dishes store ingredient ids instead of strings, so a name such as "Eggs" is kept once no matter
+ * how many dishes use it, and comparing two ingredients is an integer compare. The pool also
+ * records which allergen/diet classes (meat, dairy/egg, gluten, nuts) each ingredient belongs to.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef INGREDIENTPOOL_HPP
+#define INGREDIENTPOOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using IngredientId = std::uint32_t;
+
+/**
+ * @class IngredientPool
+ * @brief Interns ingredient names. Ids are dense, start at 0 and are never reused.
+ * All member functions are safe to call from several threads.
+ */
+class IngredientPool {
+public:
+    /**
+     * Allergen/diet classes, one bit each, so a set of classes fits in one byte.
+     */
+    enum IngredientClass : std::uint8_t { MEAT = 1 << 0, DAIRY_EGG = 1 << 1, GLUTEN = 1 << 2, NUTS = 1 << 3 };
+    static const int CLASS_COUNT = 4;
+
+    /**
+     * @return The pool shared by every Dish.
+     */
+    static IngredientPool& global();
+
+    /**
+     * Default constructor.
+     * @post The classes hold the ingredients the dietary accommodations act on:
+     * MEAT: Meat, Chicken, Fish, Beef, Pork, Lamb, Shrimp, Bacon.
+     * DAIRY_EGG: Milk, Eggs, Cheese, Butter, Cream, Yogurt.
+     * GLUTEN: Wheat, Flour, Bread, Pasta, Barley, Rye, Oats, Crust.
+     * NUTS: Almonds, Walnuts, Pecans, Hazelnuts, Peanuts, Cashews, Pistachios.
+     */
+    IngredientPool();
+    ~IngredientPool();
+    IngredientPool(const IngredientPool&) = delete;
+    IngredientPool& operator=(const IngredientPool&) = delete;
+
+    /**
+     * @param name An ingredient name.
+     * @return The id of name, adding it to the pool if it is not there yet.
+     */
+    IngredientId intern(std::string_view name);
+
+    /**
+     * @param names Ingredient names.
+     * @return The ids of names, in the same order.
+     */
+    std::vector<IngredientId> internAll(std::initializer_list<std::string_view> names);
+
+    /**
+     * @param id An id returned by intern().
+     * @return The name the id stands for. The reference stays valid for the life of the pool.
+     * Names never change once interned, so this takes no lock.
+     */
+    const std::string& name(IngredientId id) const;
+
+    /**
+     * @return The number of distinct names interned so far.
+     */
+    std::size_t size() const;
+
+    /**
+     * Adds an ingredient to a class, interning it if needed.
+     * @post classGeneration() has moved on if the ingredient was not in the class yet.
+     */
+    void addToClass(std::string_view name, IngredientClass ingredient_class);
+
+    /**
+     * @return A counter that every change to a class bumps. A mask computed from the classes is
+     * current as long as the generation read before computing it is still the one returned here.
+     */
+    std::uint32_t classGeneration() const;
+
+    /**
+     * @return The classes the ingredient belongs to, as a mask of IngredientClass bits.
+     */
+    std::uint8_t classesOf(IngredientId id) const;
+
+    /**
+     * @return The union of the classes of the ingredients in [first, last), under a single lock.
+     */
+    std::uint8_t classesOf(const IngredientId* first, const IngredientId* last) const;
+
+    /**
+     * @post classes[i] holds the classes of first[i] for every ingredient in [first, last), read
+     * under a single lock.
+     */
+    void classesOfEach(const IngredientId* first, const IngredientId* last, std::uint8_t* classes) const;
+
+    /**
+     * @return The ingredients of a class, in the order they were added to it.
+     */
+    std::vector<IngredientId> membersOf(IngredientClass ingredient_class) const;
+
+private:
+    mutable std::shared_mutex mutex_;
+    // Block b holds FIRST_BLOCK_NAMES << b names. A block never moves once published, so name()
+    // finds a name through the fixed block table without the lock
+    static const std::size_t FIRST_BLOCK_NAMES = 64;
+    static const int NAME_BLOCKS = 32;
+    std::atomic<std::string*> name_blocks_[NAME_BLOCKS];
+    std::atomic<std::size_t> size_{0};                           // Stored with release once a new name is in place
+    std::unordered_map<std::string_view, IngredientId> ids_;     // Keys view the strings in name_blocks_
+    std::deque<std::uint8_t> classes_;                           // Indexed by id
+    std::vector<IngredientId> members_[CLASS_COUNT];             // Indexed by class bit position
+    std::atomic<std::uint32_t> class_generation_{0};             // Bumped under the unique lock
+
+    IngredientId internLocked(std::string_view name);
+
+    /**
+     * @post name_blocks_[block][offset] is where the name of id is kept.
+     */
+    static void locate(IngredientId id, int& block, std::size_t& offset);
+};
+
+#endif // INGREDIENTPOOL_HPP
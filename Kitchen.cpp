@@ -10,10 +10,18 @@
  */
 
 #include "Kitchen.hpp"
+#include "DishParser.hpp"
+#include "MappedFile.hpp"
+#include "ThreadPool.hpp"
+#include "Snapshot.hpp"
+#include "EnumTables.hpp"
+#include <algorithm>
+#include <chrono>
 #include <iostream> 
 #include <fstream>
 #include <string>
-Kitchen::Kitchen() : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0) {
+Kitchen::Kitchen() : IndexedArrayBag<Dish*>(), count_elaborate_(0), cuisine_counts_{},
+    columns_class_generation_(IngredientPool::global().classGeneration()), deduplicate_(false) {
 
 }
 /**
@@ -24,204 +32,474 @@ information.
 * @post Initializes the kitchen by reading dishes from the CSV file and
 storing them as `Dish*`.
 */
-Kitchen::Kitchen(std::string filename){
-    // Open the text file named "input.txt"
+Kitchen::Kitchen(std::string filename) : Kitchen(filename, STREAM) {
+}
+
+Kitchen::Kitchen(std::string filename, LoadMode mode) : Kitchen() {
+    load(filename, mode);
+}
+
+Kitchen::LoadStats Kitchen::load(const std::string& filename, LoadMode mode)
+{
+    LoadStats stats;
+    int size_before = getCurrentSize();
+    auto start = std::chrono::steady_clock::now();
+    if (mode == MAPPED)
+    {
+        loadMapped(filename, stats);
+    }
+    else if (mode == PARALLEL)
+    {
+        loadParallel(filename, stats);
+    }
+    else
+    {
+        loadStream(filename, stats);
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.dishes = getCurrentSize() - size_before;
+    load_stats_ = stats;
+    return stats;
+}
+
+void Kitchen::loadStream(const std::string& filename, LoadStats& stats)
+{
     std::ifstream f(filename);
 
     // Check if the file is successfully opened
     if (!f.is_open()) {
         std::cout << "Error opening the file!";
+        return;
     }
 
-    // String variable to store the read data
-    ArrayBag<Dish*>();
     std::string line;
-
     std::string header;
-    getline(f,header);
+    if (getline(f,header)) {
+        stats.bytes += header.size() + 1;
+    }
 
-    // Read each line of the file and print it to the
-    // standard output stream till the whole file is
-  	// completely read
+    // Each row is tokenized in place; only the strings a dish keeps are copied
+    DishRecord record;
     while (getline(f, line)){
-        std::string dishType = line.substr(0, line.find(","));
-
-        
-        
-        line = line.substr(line.find(",") + 1); // this indexing is definetly gonna be wrong
-        std::string name = line.substr(0, line.find(",")); // making the name for the appetizer
-        line = line.substr(line.find(",") + 1);
-        
-        
-        
-        std::string ingridients = line.substr(0, line.find(",")); //making the vector of ingridients
-        std::vector<std::string> ingrid;
-
-        
-
-        while(ingridients.find(";") != std::string::npos) {
-            size_t pos = ingridients.find(";");
-            ingrid.push_back(ingridients.substr(0, pos));
-            ingridients = ingridients.substr(pos + 1);
+        stats.bytes += line.size() + 1;
+        stats.rows++;
+        if (parseDishRecord(line, record)) {
+            addRecord(record);
         }
-        ingrid.push_back(ingridients);
-        
-        line = line.substr(line.find(",") + 1);
-
-        int prep_time =  stoi(line.substr(0, line.find(","))); // getting prep time
-        line = line.substr(line.find(",") + 1);
-
-        
-
-        double price = stod(line.substr(0, line.find(","))); // getting price
-        line = line.substr(line.find(",") + 1);
-
-        
-
-        Dish::CuisineType type = Dish::OTHER; // getting type
-        if(line.substr(0, line.find(",")) == "ITALIAN"){ // ITALIAN, MEXICAN, CHINESE, INDIAN, AMERICAN, FRENCH, OTHER
-            type = Dish::ITALIAN;
-        } else if(line.substr(0, line.find(",")) == "MEXICAN"){
-            type = Dish::MEXICAN;
-        } else if(line.substr(0, line.find(",")) == "CHINESE"){
-            type = Dish::CHINESE;
-        } else if(line.substr(0, line.find(",")) == "INDIAN"){
-            type = Dish::INDIAN;
-        } else if(line.substr(0, line.find(",")) == "AMERICAN"){
-            type = Dish::AMERICAN;
-        } else if(line.substr(0, line.find(",")) == "FRENCH"){
-            type = Dish::FRENCH;
-        } else if(line.substr(0, line.find(",")) == "OTHER"){
-            type = Dish::OTHER;
+    }
+
+    f.close();
+}
+
+void Kitchen::loadMapped(const std::string& filename, LoadStats& stats)
+{
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cout << "Error opening the file!";
+        return;
+    }
+
+    // Rows are parsed straight out of the mapping, without copying them into a line buffer
+    std::string_view rest = file.contents();
+    stats.bytes = rest.size();
+    bool header = true;
+    DishRecord record;
+    while (!rest.empty()) {
+        size_t end = rest.find('\n');
+        std::string_view line = rest.substr(0, end);
+        rest = (end == std::string_view::npos) ? std::string_view() : rest.substr(end + 1);
+        if (header) {
+            header = false;
+            continue;
         }
-        line = line.substr(line.find(",") + 1);
-
-        
-        //already got &name, &ingrid, &prep_time, &price, &type so now i need the other specific ones
-         if(dishType == "APPETIZER"){ // appetizer has extra style spice and vegetarian
-            Appetizer::ServingStyle style; // getting the serving style
-            if(line.substr(0, line.find(";")) == "PLATED"){ // PLATED, FAMILY_STYLE, BUFFET
-                style = Appetizer::PLATED;
-            } else if(line.substr(0, line.find(";")) == "FAMILY_STYLE"){
-                style = Appetizer::FAMILY_STYLE;
-            } else if(line.substr(0, line.find(";")) == "BUFFET"){
-                style = Appetizer::BUFFET;
-            }
-            
-            line = line.substr(line.find(";") + 1);
-            int spice =  stoi(line.substr(0, line.find(","))); // getting spice level
-            line = line.substr(line.find(";") + 1);
-            bool veget = false; // gets the veget value 
-            if(line == "true") veget = true;
-            Appetizer *dishToAdd = new Appetizer(name, ingrid, prep_time, price, type, style, spice, veget); // me trying to store it as pointer
-            newOrder(dishToAdd);
-        } else if (dishType == "MAINCOURSE"){ // has extra enum method, string  protein, side_dishes vector , bool gluten
-            MainCourse::CookingMethod method;
-            if(line.substr(0, line.find(";")) == "GRILLED"){ // GRILLED, BAKED, BOILED, FRIED, STEAMED, RAW
-                method = MainCourse::GRILLED;
-            } else if (line.substr(0, line.find(";")) == "BAKED"){
-                method = MainCourse::BAKED;
-            } else if (line.substr(0, line.find(";")) == "BOILED"){
-                method = MainCourse::BOILED;
-            } else if (line.substr(0, line.find(";")) == "FRIED"){
-                method = MainCourse::FRIED;
-            } else if (line.substr(0, line.find(";")) == "STEAMED"){
-                method = MainCourse::STEAMED;
-            } else if (line.substr(0, line.find(";")) == "RAW"){
-                method = MainCourse::RAW;
-            }
-            line = line.substr(line.find(";") + 1);
-            std::string protein = line.substr(0, line.find(";"));
-            line = line.substr(line.find(";") + 1);
-            std::vector<MainCourse::SideDish> side_dishes;
-            std::string sides = line.substr(0, line.find(";"));
-            //there are only 2 sides so im not making a loop ---- Check if it doesnt work
-            side_dishes.push_back(MainCourse::SideDish());
-            side_dishes[0].name = sides.substr(0, sides.find(":"));
-            sides = sides.substr(sides.find(":") + 1);
-            MainCourse::Category sideCat = MainCourse::GRAIN;
-            if(sides.substr(0, sides.find("|")) == "GRAIN"){ // GRAIN, PASTA, LEGUME, BREAD, SALAD, SOUP, STARCHES, VEGETABLE
-                sideCat = MainCourse::GRAIN;
-            } else if (sides.substr(0, sides.find("|")) == "PASTA"){
-                sideCat = MainCourse::PASTA;
-            } else if (sides.substr(0, sides.find("|")) == "LEGUME"){
-                sideCat = MainCourse::LEGUME;
-            } else if (sides.substr(0, sides.find("|")) == "BREAD"){
-                sideCat = MainCourse::BREAD;
-            } else if (sides.substr(0, sides.find("|")) == "SALAD"){
-                sideCat = MainCourse::SALAD;
-            } else if (sides.substr(0, sides.find("|")) == "SOUP"){
-                sideCat = MainCourse::SOUP;
-            } else if (sides.substr(0, sides.find("|")) == "STARCHES"){
-                sideCat = MainCourse::STARCHES;
-            } else if (sides.substr(0, sides.find("|")) == "VEGETABLE"){
-                sideCat = MainCourse::VEGETABLE;
-            }
-            side_dishes[0].category = sideCat;
-            sides = sides.substr(sides.find("|") + 1);
-
-            side_dishes.push_back(MainCourse::SideDish());
-            side_dishes[1].name = sides.substr(0, sides.find(":"));
-            sides = sides.substr(sides.find(":") + 1);
-            if(sides.substr(0, sides.find("|")) == "GRAIN"){ // GRAIN, PASTA, LEGUME, BREAD, SALAD, SOUP, STARCHES, VEGETABLE
-                sideCat = MainCourse::GRAIN;
-            } else if (sides.substr(0, sides.find("|")) == "PASTA"){
-                sideCat = MainCourse::PASTA;
-            } else if (sides.substr(0, sides.find("|")) == "LEGUME"){
-                sideCat = MainCourse::LEGUME;
-            } else if (sides.substr(0, sides.find("|")) == "BREAD"){
-                sideCat = MainCourse::BREAD;
-            } else if (sides.substr(0, sides.find("|")) == "SALAD"){
-                sideCat = MainCourse::SALAD;
-            } else if (sides.substr(0, sides.find("|")) == "SOUP"){
-                sideCat = MainCourse::SOUP;
-            } else if (sides.substr(0, sides.find("|")) == "STARCHES"){
-                sideCat = MainCourse::STARCHES;
-            } else if (sides.substr(0, sides.find("|")) == "VEGETABLE"){
-                sideCat = MainCourse::VEGETABLE;
+        stats.rows++;
+        if (parseDishRecord(line, record)) {
+            addRecord(record);
+        }
+    }
+}
+
+void Kitchen::loadParallel(const std::string& filename, LoadStats& stats)
+{
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cout << "Error opening the file!";
+        return;
+    }
+    std::string_view contents = file.contents();
+    stats.bytes = contents.size();
+    size_t header_end = contents.find('\n');
+    if (header_end == std::string_view::npos) {
+        return;
+    }
+    std::string_view body = contents.substr(header_end + 1);
+
+    // Cut the body into newline-aligned chunks, a few per thread so uneven chunks even out
+    const size_t MIN_CHUNK_BYTES = 1 << 16;
+    ThreadPool& pool = ThreadPool::shared();
+    size_t target = std::max(body.size() / (pool.size() * 4), MIN_CHUNK_BYTES);
+    std::vector<std::string_view> chunks;
+    while (!body.empty()) {
+        size_t end = body.size();
+        if (target < end) {
+            size_t newline = body.find('\n', target);
+            end = (newline == std::string_view::npos) ? body.size() : newline + 1;
+        }
+        chunks.push_back(body.substr(0, end));
+        body = body.substr(end);
+    }
+
+    // Tokenize every chunk independently. The records view the mapped file, so the workers
+    // neither allocate dishes nor intern ingredients and never contend on a shared lock
+    std::vector<std::vector<DishRecord>> parsed(chunks.size());
+    std::vector<size_t> rows(chunks.size(), 0);
+    pool.run(chunks.size(), [&](size_t c) {
+        std::string_view rest = chunks[c];
+        DishRecord record;
+        while (!rest.empty()) {
+            size_t end = rest.find('\n');
+            std::string_view line = rest.substr(0, end);
+            rest = (end == std::string_view::npos) ? std::string_view() : rest.substr(end + 1);
+            rows[c]++;
+            if (parseDishRecord(line, record)) {
+                parsed[c].push_back(record);
             }
-            side_dishes[1].category = sideCat;
-            line = line.substr(line.find(";") + 1);
-            bool gluten = false;
-            if (line == "true") gluten = true;
-            MainCourse *dishToAdd = new MainCourse(name, ingrid, prep_time, price, type, method, protein, side_dishes, gluten); // me trying to store it as pointer
-            newOrder(dishToAdd);
-        } else if(dishType == "DESSERT"){ // has extra enum flavor, int sweetness, bool nuts
-            Dessert::FlavorProfile flavor;
-            if(line.substr(0, line.find(";")) == "SWEET"){ // SWEET, BITTER, SOUR, SALTY, UMAMI
-                flavor = Dessert::SWEET;
-            } else if (line.substr(0, line.find(";")) == "BITTER"){
-                flavor = Dessert::BITTER;
-            } else if (line.substr(0, line.find(";")) == "SOUR"){
-                flavor = Dessert::SOUR;
-            } else if (line.substr(0, line.find(";")) == "SALTY"){
-                flavor = Dessert::SALTY;
-            } else if (line.substr(0, line.find(";")) == "UMAMI"){
-                flavor = Dessert::UMAMI;
+        }
+    });
+
+    // Build and merge in chunk order so the kitchen ends up the same as with a serial load
+    size_t parsed_count = 0;
+    for (const std::vector<DishRecord>& records : parsed) {
+        parsed_count += records.size();
+    }
+    reserve(getCurrentSize() + parsed_count);
+    for (size_t c = 0; c < chunks.size(); c++) {
+        stats.rows += rows[c];
+        for (const DishRecord& record : parsed[c]) {
+            addRecord(record);
+        }
+    }
+}
+
+Kitchen::LoadStats Kitchen::getLoadStats() const
+{
+    return load_stats_;
+}
+
+double Kitchen::LoadStats::bytesPerSecond() const
+{
+    return seconds > 0 ? bytes / seconds : 0;
+}
+
+double Kitchen::LoadStats::rowsPerSecond() const
+{
+    return seconds > 0 ? rows / seconds : 0;
+}
+
+void Kitchen::loadReport() const
+{
+    std::cout << "ROWS: " << load_stats_.rows << std::endl;
+    std::cout << "DISHES: " << load_stats_.dishes << std::endl;
+    std::cout << "BYTES: " << load_stats_.bytes << std::endl;
+    std::cout << "SECONDS: " << load_stats_.seconds << std::endl;
+    std::cout << "BYTES/SEC: " << load_stats_.bytesPerSecond() << std::endl;
+    std::cout << "ROWS/SEC: " << load_stats_.rowsPerSecond() << std::endl;
+}
+
+void Kitchen::allocatorReport()
+{
+    const ObjectPool* pools[] = {&Appetizer::pool(), &MainCourse::pool(), &Dessert::pool()};
+    for (size_t kind = 0; kind < DISH_KIND_TABLE.names.size(); kind++)
+    {
+        std::cout << DISH_KIND_TABLE.names[kind] << " BYTES: " << pools[kind]->bytesInUse() << " IN USE, "
+                  << pools[kind]->bytesReserved() << " RESERVED IN " << pools[kind]->blockCount() << " BLOCKS" << std::endl;
+    }
+}
+
+/**
+* Builds a dish from a parsed row and orders it.
+* @param record A parsed row of a menu file.
+* @return True if the dish was added, false otherwise (the dish is then deallocated).
+*/
+bool Kitchen::addRecord(const DishRecord& record)
+{
+    Dish* dish = createDish(record);
+    if (newOrder(dish))
+    {
+        return true;
+    }
+    delete dish;
+    return false;
+}
+
+namespace {
+
+/**
+ * @return The price in whole cents, the unit price_stats_ is kept in.
+ */
+long long priceInCents(double price)
+{
+    return std::llround(price * 100);
+}
+
+const char SNAPSHOT_MAGIC[] = "KSNP";
+const std::uint32_t SNAPSHOT_VERSION = 1;
+
+void putCommon(SnapshotWriter& out, const Dish& dish)
+{
+    out.putString(dish.getName());
+    out.putU32(dish.getIngredientCount());
+    for (std::size_t i = 0; i < dish.getIngredientCount(); i++)
+    {
+        out.putString(dish.getIngredient(i));
+    }
+    out.putI32(dish.getPrepTime());
+    out.putF64(dish.getPrice());
+    out.putU8(dish.getCuisineTypeEnum());
+}
+
+/**
+* Decodes a packed enum, rejecting the file if the value is not an enumerator of the table's enum.
+*/
+template <class E, std::size_t N>
+E getEnum(SnapshotReader& in, const EnumTable<N>& table)
+{
+    std::uint8_t value = in.getU8();
+    if (value >= N)
+    {
+        in.getBytes(in.remaining() + 1); // forces the reader into its failed state
+        return static_cast<E>(0);
+    }
+    return static_cast<E>(value);
+}
+
+/**
+* Decodes the fields every dish type shares into a record.
+* The ingredients are returned separately since a record keeps them as one ';'-joined view.
+*/
+void getCommon(SnapshotReader& in, DishRecord& record, std::vector<std::string>& ingredients)
+{
+    record.name = in.getString();
+    std::uint32_t count = in.getU32();
+    ingredients.clear();
+    for (std::uint32_t i = 0; i < count && in.ok(); i++)
+    {
+        ingredients.emplace_back(in.getString());
+    }
+    record.prep_time = in.getI32();
+    record.price = in.getF64();
+    record.cuisine_type = getEnum<Dish::CuisineType>(in, CUISINE_TYPE_TABLE);
+}
+
+} // namespace
+
+bool Kitchen::saveSnapshot(const std::string& filename) const
+{
+    std::vector<const Appetizer*> appetizers;
+    std::vector<const MainCourse*> main_courses;
+    std::vector<const Dessert*> desserts;
+
+    SnapshotWriter out;
+    out.putBytes(std::string_view(SNAPSHOT_MAGIC, 4));
+    out.putU32(SNAPSHOT_VERSION);
+    out.putU32(getCurrentSize());
+    for (const Dish* dish : *this)
+    {
+        if (const Appetizer* appetizer = dynamic_cast<const Appetizer*>(dish))
+        {
+            appetizers.push_back(appetizer);
+            out.putU8(DishRecord::APPETIZER);
+        }
+        else if (const MainCourse* main_course = dynamic_cast<const MainCourse*>(dish))
+        {
+            main_courses.push_back(main_course);
+            out.putU8(DishRecord::MAINCOURSE);
+        }
+        else if (const Dessert* dessert = dynamic_cast<const Dessert*>(dish))
+        {
+            desserts.push_back(dessert);
+            out.putU8(DishRecord::DESSERT);
+        }
+        else
+        {
+            return false; // not a dish type the format knows about
+        }
+    }
+
+    out.putU32(appetizers.size());
+    for (const Appetizer* dish : appetizers)
+    {
+        putCommon(out, *dish);
+        out.putU8(dish->getServingStyle());
+        out.putI32(dish->getSpicinessLevel());
+        out.putU8(dish->isVegetarian());
+    }
+
+    out.putU32(main_courses.size());
+    for (const MainCourse* dish : main_courses)
+    {
+        putCommon(out, *dish);
+        out.putU8(dish->getCookingMethod());
+        out.putString(dish->getProteinType());
+        const MainCourse::SideDishList& side_dishes = dish->getSideDishes();
+        out.putU32(side_dishes.size());
+        for (const MainCourse::SideDish& side_dish : side_dishes)
+        {
+            out.putString(side_dish.name);
+            out.putU8(side_dish.category);
+        }
+        out.putU8(dish->isGlutenFree());
+    }
+
+    out.putU32(desserts.size());
+    for (const Dessert* dish : desserts)
+    {
+        putCommon(out, *dish);
+        out.putU8(dish->getFlavorProfile());
+        out.putI32(dish->getSweetnessLevel());
+        out.putU8(dish->containsNuts());
+    }
+
+    return out.writeTo(filename);
+}
+
+bool Kitchen::loadSnapshot(const std::string& filename)
+{
+    MappedFile file(filename);
+    if (!file.isOpen())
+    {
+        std::cout << "Error opening the file!";
+        return false;
+    }
+
+    SnapshotReader in(file.contents());
+    if (in.getBytes(4) != std::string_view(SNAPSHOT_MAGIC, 4) || in.getU32() != SNAPSHOT_VERSION)
+    {
+        return false;
+    }
+    std::uint32_t count = in.getU32();
+    std::string_view order = in.getBytes(count);
+
+    // Decode every section first so a damaged file never leaves a half-loaded kitchen. Names were
+    // validated before they were saved, so they are restored as they are rather than through setName
+    std::vector<Dish*> sections[3];
+    DishRecord record;
+    std::vector<std::string> ingredients;
+    std::uint32_t appetizer_count = in.getU32();
+    for (std::uint32_t i = 0; i < appetizer_count && in.ok(); i++)
+    {
+        getCommon(in, record, ingredients);
+        Appetizer::ServingStyle style = getEnum<Appetizer::ServingStyle>(in, SERVING_STYLE_TABLE);
+        int spiciness = in.getI32();
+        bool vegetarian = in.getU8();
+        sections[DishRecord::APPETIZER].push_back(new Appetizer(std::string(), ingredients, record.prep_time,
+            record.price, record.cuisine_type, style, spiciness, vegetarian));
+        sections[DishRecord::APPETIZER].back()->restoreName(std::string(record.name));
+    }
+    std::uint32_t main_course_count = in.getU32();
+    MainCourse::SideDishList side_dishes;
+    for (std::uint32_t i = 0; i < main_course_count && in.ok(); i++)
+    {
+        getCommon(in, record, ingredients);
+        MainCourse::CookingMethod method = getEnum<MainCourse::CookingMethod>(in, COOKING_METHOD_TABLE);
+        std::string_view protein = in.getString();
+        std::uint32_t side_count = in.getU32();
+        side_dishes.clear();
+        for (std::uint32_t s = 0; s < side_count && in.ok(); s++)
+        {
+            MainCourse::SideDish side_dish;
+            side_dish.name = std::string(in.getString());
+            side_dish.category = getEnum<MainCourse::Category>(in, SIDE_CATEGORY_TABLE);
+            side_dishes.push_back(side_dish);
+        }
+        bool gluten_free = in.getU8();
+        sections[DishRecord::MAINCOURSE].push_back(new MainCourse(std::string(), ingredients, record.prep_time,
+            record.price, record.cuisine_type, method, std::string(protein), side_dishes, gluten_free));
+        sections[DishRecord::MAINCOURSE].back()->restoreName(std::string(record.name));
+    }
+    std::uint32_t dessert_count = in.getU32();
+    for (std::uint32_t i = 0; i < dessert_count && in.ok(); i++)
+    {
+        getCommon(in, record, ingredients);
+        Dessert::FlavorProfile flavor = getEnum<Dessert::FlavorProfile>(in, FLAVOR_PROFILE_TABLE);
+        int sweetness = in.getI32();
+        bool nuts = in.getU8();
+        sections[DishRecord::DESSERT].push_back(new Dessert(std::string(), ingredients, record.prep_time,
+            record.price, record.cuisine_type, flavor, sweetness, nuts));
+        sections[DishRecord::DESSERT].back()->restoreName(std::string(record.name));
+    }
+
+    bool valid = in.ok() && count == appetizer_count + main_course_count + dessert_count;
+    size_t next[3] = {0, 0, 0};
+    for (size_t i = 0; valid && i < order.size(); i++)
+    {
+        unsigned kind = static_cast<unsigned char>(order[i]);
+        valid = kind < 3 && next[kind] < sections[kind].size();
+        if (valid)
+        {
+            next[kind]++;
+        }
+    }
+    if (!valid)
+    {
+        for (std::vector<Dish*>& section : sections)
+        {
+            for (Dish* dish : section)
+            {
+                delete dish;
             }
-            line = line.substr(line.find(";") + 1);
-            int sweetness = stoi(line.substr(0, line.find(";")));
-            line = line.substr(line.find(";") + 1);
-            bool nuts = false;
-            if(line == "true") nuts = true;
-            Dessert *dishToAdd = new Dessert(name, ingrid, prep_time, price, type, flavor, sweetness, nuts); // me trying to store it as pointer
-            newOrder(dishToAdd);
-        } //*/
-    }
-    
-    // Close the file 
-    
-    f.close();
+        }
+        return false;
+    }
+
+    // Put the dishes back in the order they were saved in
+    reserve(getCurrentSize() + count);
+    next[0] = next[1] = next[2] = 0;
+    for (char kind : order)
+    {
+        Dish* dish = sections[static_cast<unsigned char>(kind)][next[static_cast<unsigned char>(kind)]++];
+        if (!newOrder(dish))
+        {
+            delete dish;
+        }
+    }
+    return true;
+}
+
+void Kitchen::setContentDeduplication(bool enabled)
+{
+    deduplicate_ = enabled;
+    content_index_.clear();
+    if (enabled)
+    {
+        content_index_.reserve(getCurrentSize());
+        content_index_.insert(begin(), end());
+    }
+}
+
+bool Kitchen::getContentDeduplication() const
+{
+    return deduplicate_;
 }
 
 bool Kitchen::newOrder(Dish* new_dish)
 {
+    if (deduplicate_ && content_index_.count(new_dish) > 0)
+    {
+        return false;
+    }
     if (add(new_dish))
     {
-        total_prep_time_ += (*new_dish).getPrepTime();
+        columns_.append(new_dish);
+        if (deduplicate_)
+        {
+            content_index_.insert(new_dish);
+        }
+        prep_time_stats_.add(new_dish->getPrepTime());
+        price_stats_.add(priceInCents(new_dish->getPrice()));
+        cuisine_counts_[new_dish->getCuisineTypeEnum()]++;
         //std::cout<< "Dish added: "<<new_dish.getName() << std::endl;
-        //if the new dish has 5 or more ingredients AND takes an hour or more to prepare, increment count_elaborate_
-        if ((*new_dish).getIngredients().size() >= 5 && (*new_dish).getPrepTime() >= 60)
+        if (new_dish->isElaborate())
         {
             //std::cout << "Elaborate dish added: "<<new_dish.getName() << std::endl;
             count_elaborate_++;
@@ -236,10 +514,23 @@ bool Kitchen::serveDish(Dish* dish_to_remove)
     {
         return false;
     }
-    if (remove(dish_to_remove))
+    int slot = getIndexOf(dish_to_remove);
+    if (slot >= 0 && remove(dish_to_remove))
     {
-        total_prep_time_ -= (*dish_to_remove).getPrepTime();
-        if ((*dish_to_remove).getIngredients().size() >= 5 && (*dish_to_remove).getPrepTime() >= 60)
+        columns_.removeAt(slot);
+        if (deduplicate_)
+        {
+            // Only drop the entry if it is this dish and not an equal one that was already present
+            auto entry = content_index_.find(dish_to_remove);
+            if (entry != content_index_.end() && *entry == dish_to_remove)
+            {
+                content_index_.erase(entry);
+            }
+        }
+        prep_time_stats_.remove(dish_to_remove->getPrepTime());
+        price_stats_.remove(priceInCents(dish_to_remove->getPrice()));
+        cuisine_counts_[dish_to_remove->getCuisineTypeEnum()]--;
+        if (dish_to_remove->isElaborate())
         {
             count_elaborate_--;
         }
@@ -247,13 +538,49 @@ bool Kitchen::serveDish(Dish* dish_to_remove)
     }
     return false;
 }
+void Kitchen::reserve(int new_capacity)
+{
+    IndexedArrayBag<Dish*>::reserve(new_capacity);
+    columns_.reserve(new_capacity);
+}
+
+const DishColumns& Kitchen::getColumns() const
+{
+    return columns_;
+}
+
+void Kitchen::refreshAllergens()
+{
+    // Read the generation first, so a class changed during the refresh leaves the columns stale
+    std::uint32_t generation = IngredientPool::global().classGeneration();
+    for (int slot = 0; slot < getCurrentSize(); slot++)
+    {
+        items_[slot]->updateAllergens();
+        columns_.refresh(slot, items_[slot]);
+    }
+    columns_class_generation_ = generation;
+}
+
+bool Kitchen::allergenColumnsCurrent() const
+{
+    return columns_class_generation_ == IngredientPool::global().classGeneration();
+}
+
+Kitchen::Stats Kitchen::stats() const
+{
+    Stats stats;
+    stats.prep_time = prep_time_stats_.summary();
+    stats.price = price_stats_.summary(100.0);
+    return stats;
+}
+
 int Kitchen::getPrepTimeSum() const
 {
     if (getCurrentSize() == 0)
     {
         return 0;
     }
-    return total_prep_time_;
+    return static_cast<int>(prep_time_stats_.sum());
 }
 int Kitchen::calculateAvgPrepTime() const
 {
@@ -261,15 +588,7 @@ int Kitchen::calculateAvgPrepTime() const
     {
         return 0;
     }
-    double total_prep_time_ = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
-    {
-        total_prep_time_ += (*items_[i]).getPrepTime();
-    }
-    total_prep_time_ = total_prep_time_ / getCurrentSize();
-    // std::cout<< "Total prep time: "<<total_prep_time_ << std::endl;
-    // std::cout<<"rounded: "<<round(total_prep_time_)<<std::endl;
-    return round(total_prep_time_);
+    return round(prep_time_stats_.mean());
 }
 int Kitchen::elaborateDishCount() const
 {
@@ -305,53 +624,117 @@ double Kitchen::calculateElaboratePercentage() const
     //return count_elaborate_ / getCurrentSize();
 }
 int Kitchen::tallyCuisineTypes(const std::string& cuisine_type) const{
-    int count = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
+    int type = CUISINE_TYPE_TABLE.find(cuisine_type);
+    if (type < 0)
     {
-        if ((*items_[i]).getCuisineType() == cuisine_type)
-        {
-            count++;
-        }
+        return 0;
+    }
+    return tallyCuisineTypes(static_cast<Dish::CuisineType>(type));
+}
+int Kitchen::tallyCuisineTypes(Dish::CuisineType cuisine_type) const{
+    return cuisine_counts_[cuisine_type];
+}
+int Kitchen::countDishesFreeOf(std::uint8_t allergens) const
+{
+    if (allergenColumnsCurrent()) {
+        return columns_.countFreeOf(allergens);
+    }
+    int count = 0;
+    for (const Dish* dish : *this) {
+        count += !dish->hasAllergens(allergens);
     }
     return count;
 }
-int Kitchen::releaseDishesBelowPrepTime(const int& prep_time)
+int Kitchen::countDishesSatisfying(const Dish::DietaryRequest& request) const
 {
+    std::uint8_t mask = Dish::requestMask(request);
+    if (allergenColumnsCurrent()) {
+        return columns_.countSatisfying(mask);
+    }
     int count = 0;
-    int num= getCurrentSize();
-    for (int i = 0; i < num; i++)
-    {
-        if ((*items_[i]).getPrepTime() < prep_time)
-        {
-            count++;
-            serveDish(items_[i]);
-        }
+    for (const Dish* dish : *this) {
+        count += (dish->dietaryProfile() & mask) == mask;
     }
     return count;
 }
 
+std::vector<const Dish*> Kitchen::dishesSatisfying(const Dish::DietaryRequest& request) const
+{
+    std::uint8_t mask = Dish::requestMask(request);
+    std::vector<const Dish*> dishes;
+    if (!allergenColumnsCurrent()) {
+        for (const Dish* dish : *this) {
+            if ((dish->dietaryProfile() & mask) == mask) {
+                dishes.push_back(dish);
+            }
+        }
+        return dishes;
+    }
+    for (int slot : columns_.rowsSatisfying(mask)) {
+        dishes.push_back(items_[slot]);
+    }
+    return dishes;
+}
+
+int Kitchen::releaseDishesBelowPrepTime(const int& prep_time)
+{
+    return deleteReleased(releaseSlotsIf([this, prep_time](int slot, const Dish*) { return columns_.prepTime(slot) < prep_time; }));
+}
+
 int Kitchen::releaseDishesOfCuisineType(const std::string& cuisine_type)
 {
-    int count = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
+    int type = CUISINE_TYPE_TABLE.find(cuisine_type);
+    if (type < 0)
     {
-        if ((*items_[i]).getCuisineType() == cuisine_type)
+        return 0;
+    }
+    return deleteReleased(releaseSlotsIf([this, type](int slot, const Dish*) { return columns_.cuisineType(slot) == type; }));
+}
+
+/**
+* Deletes dishes the kitchen released but nobody took ownership of.
+* @return The number of dishes deleted.
+*/
+int Kitchen::deleteReleased(const std::vector<Dish*>& released)
+{
+    for (Dish* dish : released)
+    {
+        delete dish;
+    }
+    return released.size();
+}
+
+/**
+* Updates the running totals and the content index for dishes that left the bag in bulk.
+*/
+void Kitchen::forgetReleased(const std::vector<Dish*>& released)
+{
+    int elaborate = 0;
+    for (Dish* dish : released)
+    {
+        prep_time_stats_.remove(dish->getPrepTime());
+        price_stats_.remove(priceInCents(dish->getPrice()));
+        elaborate += dish->isElaborate();
+        cuisine_counts_[dish->getCuisineTypeEnum()]--;
+        if (deduplicate_)
         {
-            count++;
-            serveDish(items_[i]);
+            auto entry = content_index_.find(dish);
+            if (entry != content_index_.end() && *entry == dish)
+            {
+                content_index_.erase(entry);
+            }
         }
     }
-    return count;
+    count_elaborate_ -= elaborate;
 }
+
 void Kitchen::kitchenReport() const
 {
-    std::cout << "ITALIAN: " << tallyCuisineTypes("ITALIAN") << std::endl;
-    std::cout << "MEXICAN: " << tallyCuisineTypes("MEXICAN") << std::endl;
-    std::cout << "CHINESE: " << tallyCuisineTypes("CHINESE") << std::endl;
-    std::cout << "INDIAN: " << tallyCuisineTypes("INDIAN") << std::endl;
-    std::cout << "AMERICAN: " << tallyCuisineTypes("AMERICAN") << std::endl;
-    std::cout << "FRENCH: " << tallyCuisineTypes("FRENCH") << std::endl;
-    std::cout << "OTHER: " << tallyCuisineTypes("OTHER") << std::endl<<std::endl;
+    for (int type = 0; type <= Dish::OTHER; type++)
+    {
+        std::cout << CUISINE_TYPE_TABLE.names[type] << ": " << cuisine_counts_[type] << std::endl;
+    }
+    std::cout << std::endl;
     std::cout << "AVERAGE PREP TIME: " << calculateAvgPrepTime() << std::endl;
     std::cout << "ELABORATE DISHES: " << calculateElaboratePercentage() << "%" << std::endl;
 }
@@ -364,15 +747,35 @@ accommodations.
 * @post Calls the `dietaryAccommodations()` method on each dish in the
 kitchen to adjust them accordingly.
 */
-void Kitchen::dietaryAdjustment(Dish::DietaryRequest request) const{
-    int count = 0;
-    for (Dish* i : items_)
+void Kitchen::dietaryAdjustment(Dish::DietaryRequest request){
+    std::uint32_t generation = IngredientPool::global().classGeneration();
+    adjustSlots(request, 0, getCurrentSize());
+    columns_class_generation_ = generation;
+    // Removing ingredients can make a dish stop being elaborate
+    count_elaborate_ = columns_.countElaborate();
+}
+
+void Kitchen::dietaryAdjustmentParallel(Dish::DietaryRequest request){
+    // A batch of adjacent slots keeps one thread on a run of pointers and column rows, and is
+    // big enough that handing out batches costs little next to adjusting the dishes
+    const int BATCH_DISHES = 256;
+    std::uint32_t generation = IngredientPool::global().classGeneration();
+    int dish_count = getCurrentSize();
+    size_t batches = (dish_count + BATCH_DISHES - 1) / BATCH_DISHES;
+    ThreadPool::shared().run(batches, [&](size_t b) {
+        int first = static_cast<int>(b) * BATCH_DISHES;
+        adjustSlots(request, first, std::min(first + BATCH_DISHES, dish_count));
+    });
+    columns_class_generation_ = generation;
+    count_elaborate_ = columns_.countElaborate();
+}
+
+void Kitchen::adjustSlots(const Dish::DietaryRequest& request, int first, int last){
+    // Each dish and each column row is touched by exactly one call, so batches can run concurrently
+    for (int slot = first; slot < last; slot++)
     {
-        count ++;
-        if(count <= item_count_){
-            (*i).dietaryAccommodations(request);
-        }
-        
+        items_[slot]->dietaryAccommodations(request);
+        columns_.refresh(slot, items_[slot]);
     }
 }
 
@@ -383,21 +786,25 @@ void Kitchen::dietaryAdjustment(Dish::DietaryRequest request) const{
 
 void Kitchen::displayMenu() const{
     //std::cout << "display menu called" << std::endl;
-    int count = 0;
-    for (Dish* i : items_)
+    for (const Dish* dish : *this)
     {
-        count ++;
-        if(count <= item_count_){
-            (*i).display();
-            std::cout <<std::endl;
-        }
+        dish->display();
+        std::cout <<std::endl;
     }
     //std::cout << "display menu ended" << std::endl;
 }
 
+void Kitchen::displayMenu(const Dish::DietaryRequest& request) const{
+    for (const Dish* dish : *this)
+    {
+        dish->dietaryView(request).display();
+        std::cout <<std::endl;
+    }
+}
+
 Kitchen::~Kitchen(){
-    for (Dish *i : items_)
+    for (Dish* dish : *this)
     {
-        delete i;
-    } 
+        delete dish;
+    }
 }
\ No newline at end of file
@@ -13,17 +13,59 @@
 #ifndef KITCHEN_HPP
 #define KITCHEN_HPP
 
-#include "ArrayBag.hpp"
+#include "IndexedArrayBag.hpp"
+#include "DishColumns.hpp"
+#include "DishParser.hpp"
+#include "RunningStats.hpp"
 #include "Dish.hpp"
 #include "Appetizer.hpp"
 #include "Dessert.hpp"
 #include "MainCourse.hpp"
 #include <vector>
+#include <unordered_set>
 // for round
 #include <cmath>
 
-class Kitchen : public ArrayBag<Dish*> {
+class Kitchen : public IndexedArrayBag<Dish*> {
     public:
+        /**
+        * How a menu file is read.
+        * STREAM reads it line by line through std::ifstream.
+        * MAPPED memory-maps it and parses the rows in place.
+        * PARALLEL memory-maps it and tokenizes newline-aligned chunks on ThreadPool::shared(), then
+        * builds the dishes in file order, exactly as the other modes would add them.
+        */
+        enum LoadMode { STREAM, MAPPED, PARALLEL };
+
+        /**
+        * Throughput of the most recent load.
+        */
+        struct LoadStats {
+            size_t bytes = 0;     // bytes of the file that were read, header included
+            size_t rows = 0;      // data rows seen, header excluded
+            size_t dishes = 0;    // rows that ended up in the kitchen
+            double seconds = 0.0; // wall-clock time of the load
+
+            /**
+            * @return bytes / seconds, or 0 if the load took no measurable time.
+            */
+            double bytesPerSecond() const;
+
+            /**
+            * @return rows / seconds, or 0 if the load took no measurable time.
+            */
+            double rowsPerSecond() const;
+        };
+
+        /**
+        * Running statistics of the dishes currently in the kitchen. Prices are tracked in whole cents,
+        so their sums stay exact, and reported in dollars.
+        */
+        struct Stats {
+            RunningStats::Summary prep_time; // minutes
+            RunningStats::Summary price;     // dollars
+        };
+
         Kitchen();
         /**
         * Parameterized constructor.
@@ -34,14 +76,162 @@ class Kitchen : public ArrayBag<Dish*> {
         storing them as `Dish*`.
         */
         Kitchen(std::string filename);
+
+        /**
+        * Parameterized constructor.
+        * @param filename The name of the input CSV file containing dish information.
+        * @param mode How the file is read.
+        * @post Initializes the kitchen by reading dishes from the CSV file.
+        */
+        Kitchen(std::string filename, LoadMode mode);
+
+        /**
+        * Reads dishes from a CSV file and adds them to the kitchen.
+        * @param filename The name of the input CSV file containing dish information.
+        * @param mode How the file is read.
+        * @return The throughput of this load. Also available afterwards from getLoadStats().
+        */
+        LoadStats load(const std::string& filename, LoadMode mode = STREAM);
+
+        /**
+        * @return The throughput of the most recent load.
+        */
+        LoadStats getLoadStats() const;
+
+        /**
+        * Prints the throughput of the most recent load.
+        */
+        void loadReport() const;
+
+        /**
+        * Prints, for each dish type, the bytes its object pool has handed out and the bytes of the
+        * blocks it holds. Every Appetizer, MainCourse and Dessert created with new comes from these
+        * pools, so loading a menu costs a handful of block allocations rather than one per row.
+        */
+        static void allocatorReport();
+
+        /**
+        * Turns content deduplication on or off.
+        * While it is on, newOrder rejects a dish that is equal to one already in the kitchen
+        * (same name, preparation time, price and cuisine type), found in O(1) through the dishes'
+        * cached fingerprints. Turning it on indexes the dishes already in the kitchen; duplicates
+        * that are already present stay.
+        * @note The name, preparation time, price and cuisine type of a dish must not be changed
+        while it is in a deduplicating kitchen.
+        */
+        void setContentDeduplication(bool enabled);
+
+        /**
+        * @return True if content deduplication is on, false otherwise.
+        */
+        bool getContentDeduplication() const;
+
+        /**
+        * Writes every dish in the kitchen to a binary snapshot file.
+        * The file holds a versioned header, the dish type of every slot in kitchen order,
+        * then one section per subtype of length-prefixed strings and packed enums.
+        * @param filename The snapshot file to create or replace.
+        * @return True if the snapshot was written, false otherwise.
+        */
+        bool saveSnapshot(const std::string& filename) const;
+
+        /**
+        * Adds the dishes of a snapshot written by saveSnapshot(), in the order they were saved.
+        * The file is memory-mapped and decoded in place.
+        * @param filename The snapshot file to read.
+        * @return True if the snapshot was read, false if it is missing, truncated or of another version
+        (the kitchen is then left unchanged).
+        */
+        bool loadSnapshot(const std::string& filename);
+
+        /**
+        * Adds a dish to the kitchen.
+        * @param new_dish The dish to add. The kitchen takes ownership of it if it is added.
+        * @return True if the dish was added. False if this pointer is already in the kitchen, or if
+        content deduplication is on and an equal dish (Dish::operator==) is already in the kitchen.
+        */
         bool newOrder(Dish* new_dish);
         bool serveDish(Dish* dish_to_remove);
+
+        /**
+        * @param new_capacity The number of dishes the kitchen should be able to hold.
+        * @post The bag, its index and the columns can hold new_capacity dishes without reallocating.
+        */
+        void reserve(int new_capacity);
+
+        /**
+        * @return The per-slot columns of prep time, cuisine type, elaborate flag, allergens and dietary profile.
+        * Row i describes the dish in slot i. The allergen and dietary columns lag behind a class
+        added to IngredientPool after the dishes until refreshAllergens() or a dietary adjustment.
+        */
+        const DishColumns& getColumns() const;
+
+        /**
+        * Recomputes every dish's allergen mask and its allergen and dietary columns, e.g. after
+        a rules file added ingredients to a class.
+        * @post The column queries below answer from the columns again instead of the dishes.
+        */
+        void refreshAllergens();
+
+        /**
+        * @return The statistics of prep time and price, kept up to date by newOrder, serveDish and the
+        release functions, so taking the snapshot costs O(1).
+        */
+        Stats stats() const;
+
         int getPrepTimeSum() const;
         int calculateAvgPrepTime() const;
         int elaborateDishCount() const;
         double calculateElaboratePercentage() const;
         int tallyCuisineTypes(const std::string& cuisine_type) const;
+
+        /**
+        * @return The number of dishes of the cuisine type, read from a counter that newOrder, serveDish
+        and the release functions keep up to date.
+        */
+        int tallyCuisineTypes(Dish::CuisineType cuisine_type) const;
+
+        /**
+        * @param allergens A mask of IngredientPool classes, e.g. IngredientPool::MEAT | IngredientPool::DAIRY_EGG.
+        * @return The number of dishes with no ingredient in any of those classes, counted with one
+        * scan over the allergen column, or over the dishes while a class has changed since the
+        * column was last refreshed.
+        */
+        int countDishesFreeOf(std::uint8_t allergens) const;
+
+        /**
+        * @param request The dietary requirements a guest filters the menu by.
+        * @return The number of dishes that already satisfy every field set in request (see
+        Dish::dietaryProfile()), counted from the per-request slot bitmaps, or from the dishes while
+        a class has changed since the bitmaps were last refreshed.
+        */
+        int countDishesSatisfying(const Dish::DietaryRequest& request) const;
+
+        /**
+        * @param request The dietary requirements a guest filters the menu by.
+        * @return The dishes that already satisfy every field set in request, in slot order.
+        The kitchen keeps ownership of them.
+        */
+        std::vector<const Dish*> dishesSatisfying(const Dish::DietaryRequest& request) const;
+        /**
+        * Removes every dish for which pred returns true, in one pass.
+        * @param pred Called once per dish, as pred(const Dish*), in kitchen order.
+        * @return The released dishes, in kitchen order. The caller takes ownership of them.
+        * @post The remaining dishes keep their order; the prep time sum and elaborate count are updated.
+        */
+        template <class Predicate>
+        std::vector<Dish*> releaseIf(Predicate pred);
+
+        /**
+        * Removes and deletes every dish that takes less than prep_time minutes to prepare.
+        * @return The number of dishes removed. Use releaseIf() to keep the dishes instead.
+        */
         int releaseDishesBelowPrepTime(const int& prep_time);
+
+        /**
+        * Removes and deletes every dish of the cuisine type.
+        * @return The number of dishes removed. Use releaseIf() to keep the dishes instead.
+        */
         int releaseDishesOfCuisineType(const std::string& cuisine_type);
         void kitchenReport() const;
 
@@ -56,14 +246,28 @@ class Kitchen : public ArrayBag<Dish*> {
         * @param request A DietaryRequest structure specifying the dietary
         accommodations.
         * @post Calls the `dietaryAccommodations()` method on each dish in the
-        kitchen to adjust them accordingly.
+        kitchen to adjust them accordingly, then refreshes the columns and the elaborate count.
+        */
+        void dietaryAdjustment(Dish::DietaryRequest request);
+
+        /**
+        * Adjusts all dishes like dietaryAdjustment(), spread over ThreadPool::shared() in batches
+        of adjacent slots. The dishes and columns end up exactly as with dietaryAdjustment().
+        * @param request A DietaryRequest structure specifying the dietary
+        accommodations.
         */
-        void dietaryAdjustment(Dish::DietaryRequest request) const;
+        void dietaryAdjustmentParallel(Dish::DietaryRequest request);
         /**
         * Displays all dishes currently in the kitchen.
         * @post Calls the `display()` method of each dish.
         */
         void displayMenu() const;
+
+        /**
+        * Displays all dishes as dietaryAdjustment(request) would leave them, without changing them.
+        * @post Calls `display()` on each dish's Dish::dietaryView() for the request.
+        */
+        void displayMenu(const Dish::DietaryRequest& request) const;
         /**
         * Destructor.
         * @post Deallocates all dynamically allocated dishes to prevent memory
@@ -75,10 +279,73 @@ class Kitchen : public ArrayBag<Dish*> {
 
 
     private:
-        int total_prep_time_;
+        // Changing the bag directly would skip the columns, statistics, cuisine counts and content
+        // index, so only newOrder, serveDish and the release functions may change a Kitchen
+        using IndexedArrayBag<Dish*>::add;
+        using IndexedArrayBag<Dish*>::remove;
+        using IndexedArrayBag<Dish*>::clear;
+        using IndexedArrayBag<Dish*>::removeIf;
+        using IndexedArrayBag<Dish*>::shrink_to_fit;
+
+        RunningStats prep_time_stats_;
+        RunningStats price_stats_;    // In cents
         int count_elaborate_;
+        int cuisine_counts_[Dish::OTHER + 1]; // Dishes per CuisineType
+
+        LoadStats load_stats_;
+        DishColumns columns_;
+        std::uint32_t columns_class_generation_; // IngredientPool::classGeneration() the oldest allergen row was computed at
+
+        struct DishContentHash {
+            size_t operator()(const Dish* dish) const { return std::hash<Dish>()(*dish); }
+        };
+        struct DishContentEqual {
+            bool operator()(const Dish* lhs, const Dish* rhs) const { return *lhs == *rhs; }
+        };
+        bool deduplicate_;
+        std::unordered_set<Dish*, DishContentHash, DishContentEqual> content_index_;
+
+        /**
+        * Removes every dish for which pred(slot, dish) returns true, keeping the columns in step.
+        * pred may read columns_ at slot; it is called in slot order before anything moves.
+        */
+        template <class SlotPredicate>
+        std::vector<Dish*> releaseSlotsIf(SlotPredicate pred);
+        void forgetReleased(const std::vector<Dish*>& released);
+        static int deleteReleased(const std::vector<Dish*>& released);
+        void adjustSlots(const Dish::DietaryRequest& request, int first, int last);
+        bool allergenColumnsCurrent() const;
+        bool addRecord(const DishRecord& record);
+        void loadStream(const std::string& filename, LoadStats& stats);
+        void loadMapped(const std::string& filename, LoadStats& stats);
+        void loadParallel(const std::string& filename, LoadStats& stats);
         //std::vector<Dish*> dishes_;
     
 };
 
+template <class Predicate>
+std::vector<Dish*> Kitchen::releaseIf(Predicate pred)
+{
+    return releaseSlotsIf([&pred](int, const Dish* dish) { return pred(dish); });
+}
+
+template <class SlotPredicate>
+std::vector<Dish*> Kitchen::releaseSlotsIf(SlotPredicate pred)
+{
+    std::vector<char> removed_rows;
+    removed_rows.reserve(getCurrentSize());
+    int slot = 0;
+    std::vector<Dish*> released = removeIf([&](Dish* dish) {
+        bool release = pred(slot++, static_cast<const Dish*>(dish));
+        removed_rows.push_back(release);
+        return release;
+    });
+    if (!released.empty())
+    {
+        columns_.compact(removed_rows);
+    }
+    forgetReleased(released);
+    return released;
+}
+
 #endif // KITCHEN_HPP
\ No newline at end of file
@@ -10,6 +10,8 @@
  */
 
 #include "MainCourse.hpp"
+#include "DishParser.hpp"
+#include "EnumTables.hpp"
 
 /**
  * Default constructor.
@@ -30,7 +32,7 @@ MainCourse::MainCourse()
  * @param side_dishes The side dishes served with the main course.
  * @param gluten_free Flag indicating if the main course is gluten-free.
  */
-MainCourse::MainCourse(const std::string& name, const std::vector<std::string>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, const bool &gluten_free)
+MainCourse::MainCourse(const std::string& name, const std::vector<std::string>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, const std::string& protein_type, const SideDishList& side_dishes, const bool &gluten_free)
     : Dish(name, ingredients, prep_time, price, cuisine_type), cooking_method_(cooking_method), protein_type_(protein_type), side_dishes_(side_dishes), gluten_free_(gluten_free) {}
 
 /**
@@ -39,6 +41,7 @@ MainCourse::MainCourse(const std::string& name, const std::vector<std::string>&
  * @post Sets the private member `cooking_method_` to the value of the parameter.
  */
 void MainCourse::setCookingMethod(const CookingMethod &cooking_method) {
+    invalidateViews();
     cooking_method_ = cooking_method;
 }
 
@@ -55,6 +58,7 @@ MainCourse::CookingMethod MainCourse::getCookingMethod() const {
  * @post Sets the private member `protein_type_` to the value of the parameter.
  */
 void MainCourse::setProteinType(const std::string& protein_type) {
+    invalidateViews();
     protein_type_ = protein_type;
 }
 
@@ -71,13 +75,14 @@ std::string MainCourse::getProteinType() const {
  * @post Adds the side dish to the `side_dishes_` vector.
  */
 void MainCourse::addSideDish(const SideDish& side_dish) {
+    invalidateViews();
     side_dishes_.push_back(side_dish);
 }
 
 /**
  * @return A vector of SideDish structs representing the side dishes served with the main course.
  */
-std::vector<MainCourse::SideDish> MainCourse::getSideDishes() const {
+const MainCourse::SideDishList& MainCourse::getSideDishes() const {
     return side_dishes_;
 }
 
@@ -87,6 +92,7 @@ std::vector<MainCourse::SideDish> MainCourse::getSideDishes() const {
  * @post Sets the private member `gluten_free_` to the value of the parameter.
  */
 void MainCourse::setGlutenFree(const bool &gluten_free) {
+    invalidateViews();
     gluten_free_ = gluten_free;
 }
 
@@ -120,9 +126,9 @@ bool MainCourse::isGlutenFree() const {
         //std::cout << "CALLED MAIN COURSE DISPLAY" << std::endl;
         std::cout << "Dish Name: " << getName() << std::endl;
         std::cout << "Ingredients: ";
-        for (size_t i = 0; i < getIngredients().size(); ++i) {
-            std::cout << getIngredients()[i];
-            if (i != getIngredients().size() - 1) {
+        for (size_t i = 0; i < getIngredientCount(); ++i) {
+            std::cout << getIngredient(i);
+            if (i != getIngredientCount() - 1) {
                 std::cout << ", ";
             }
         }
@@ -130,32 +136,13 @@ bool MainCourse::isGlutenFree() const {
         std::cout << "Preparation Time: " << getPrepTime() << " minutes" << std::endl;
         std::cout << std::fixed << std::setprecision(2) << "Price: $" << getPrice() << std::endl;
         std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
-        std::cout << "Cooking Method: ";
-        switch (getCookingMethod()) {
-            case CookingMethod::GRILLED: std::cout << "Grilled";  break;
-            case CookingMethod::BAKED: std::cout << "Baked"; break;
-            case CookingMethod::BOILED: std::cout << "Boiled"; break;
-            case CookingMethod::FRIED: std::cout << "Fried"; break;
-            case CookingMethod::STEAMED: std::cout << "Steamed"; break;
-            case CookingMethod::RAW: std::cout << "Raw"; break;
-        }
-        std::cout << std::endl;
+        std::cout << "Cooking Method: " << enumLabel(COOKING_METHOD_TABLE, getCookingMethod()) << std::endl;
         std::cout << "Protein Type: " << getProteinType() << std::endl;
         std::cout << "Side Dishes: " << std::endl; // dont know if i need the endl here---
-        for (size_t i = 0; i < getSideDishes().size(); ++i) {
-            std::cout << getSideDishes()[i].name << " (Category: ";
-            switch (getSideDishes()[i].category) {
-                case Category::GRAIN: std::cout << "Grain"; break;
-                case Category::PASTA: std::cout << "Pasta"; break;
-                case Category::LEGUME: std::cout << "Legume"; break;
-                case Category::BREAD: std::cout << "Bread"; break;
-                case Category::SALAD: std::cout << "Salad"; break;
-                case Category::SOUP: std::cout << "Soup"; break;
-                case Category::STARCHES: std::cout << "Starches"; break;
-                case Category::VEGETABLE: std::cout << "Vegetable"; break;
-            }
-            std::cout << ")";
-            if (i != getSideDishes().size() - 1) {
+        const SideDishList& side_dishes = getSideDishes();
+        for (size_t i = 0; i < side_dishes.size(); ++i) {
+            std::cout << side_dishes[i].name << " (Category: " << enumLabel(SIDE_CATEGORY_TABLE, side_dishes[i].category) << ")";
+            if (i != side_dishes.size() - 1) {
                 std::cout << std::endl;
             }
         }
@@ -195,66 +182,47 @@ bool MainCourse::isGlutenFree() const {
     */
     void MainCourse::dietaryAccommodations(const Dish::DietaryRequest request){
         //std::cout << "main course diatery accomedation called" << std::endl;
-        if(request.vegetarian){
-            //std::cout << "main course request vegetarian" << std::endl;
-            setProteinType("Tofu");
-            bool first = 1, second = 1;
-            std::string s;
-            std::vector<std::string> nonVeg = {"Meat", "Chicken", "Fish", "Beef", "Pork", "Lamb", "Shrimp", "Bacon"};
-            std::vector<std::string> ingrid = getIngredients();
-            for (int i = 0; i < (int) ingrid.size(); ++i) {
-                for (auto &&j : nonVeg){
-                    if(j == ingrid[i]){ // ingrid[i].find(j) != std::string::npos
-                        if(first){
-                            ingrid[i] = "Beans";
-                            first = false;
-                        } else if(second){
-                            ingrid[i] = "Mushrooms";
-                            second = false;
-                        } else {
-                            auto pos = ingrid.begin() + i; // check that this removes properly
-                            ingrid.erase(pos);
-                        }
-                    }
-                }
-            }
-            setIngredients(ingrid);
-            //std::cout << "main course request vegetarian ended" << std::endl;
-            //display();
-        }
-        if(request.vegan == true){
-            //std::cout << "vegan called for some reason" << std::endl; 
-            std::string s;
+        applyDietaryRules(DishRecord::MAINCOURSE, request);
+        if(request.vegetarian || request.vegan){
             setProteinType("Tofu");
-            //std::cout << "Protiend type: " << getProteinType() << std::endl;
-            std::vector<std::string> nonVeg = {"Milk", "Eggs", "Cheese", "Butter", "Cream", "Yogurt"};
-            std::vector<std::string> ingrid = getIngredients();
-            for (int i = 0; i < (int) ingrid.size(); ++i) {
-                for (auto &&j : nonVeg){
-                    if(j == ingrid[i]){ // ingrid[i].find(j) != std::string::npos if it wasnt just a list
-                        auto pos = ingrid.begin() + i; // check that this removes properly
-                        ingrid.erase(pos);
-                    }
-                }
-            }
-            setIngredients(ingrid);
-            //display();
         }
         if(request.gluten_free){
             //std::cout << "gluten free called" << std::endl;
-            std::string s;
             setGlutenFree(true);
-            std::vector<Category> nonVeg = {Category::GRAIN, Category::PASTA, Category::BREAD, Category::STARCHES};
-            std::vector<SideDish> dishes = getSideDishes();
-            for (int i = 0; i < (int) dishes.size(); ++i) {
-                for (auto &&j : nonVeg){
-                    if(j == dishes[i].category){
-                        auto pos = dishes.begin() + i; // check that this removes properly
-                        dishes.erase(pos);
+            // Drop the grain-based sides in one stable pass
+            std::size_t keep = 0;
+            for (std::size_t i = 0; i < side_dishes_.size(); ++i) {
+                Category category = side_dishes_[i].category;
+                if (category != GRAIN && category != PASTA && category != BREAD && category != STARCHES) {
+                    if (keep != i) {
+                        side_dishes_[keep] = std::move(side_dishes_[i]);
                     }
+                    ++keep;
                 }
             }
-            side_dishes_ = dishes;
+            while (side_dishes_.size() > keep) {
+                side_dishes_.pop_back();
+            }
         }
         //std::cout << "main course diatery accomedation ended" << std::endl;
-    }
\ No newline at end of file
+    }
+
+MainCourse* MainCourse::clone() const {
+    return new MainCourse(*this);
+}
+
+std::uint8_t MainCourse::dietaryProfile() const {
+    std::uint8_t profile = Dish::dietaryProfile();
+    if (protein_type_ != "Tofu") {
+        // A vegetarian or vegan accommodation sets the protein to Tofu, so any other one is unmet
+        profile &= ~(VEGETARIAN | VEGAN);
+    }
+    for (const SideDish& side_dish : side_dishes_) {
+        Category category = side_dish.category;
+        if (category == GRAIN || category == PASTA || category == BREAD || category == STARCHES) {
+            profile &= ~GLUTEN_FREE;
+            break;
+        }
+    }
+    return profile;
+}
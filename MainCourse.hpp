@@ -13,6 +13,7 @@
 #define MAINCOURSE_HPP
 
 #include "Dish.hpp"
+#include "ObjectPool.hpp"
 #include <string>
 #include <vector>
 
@@ -20,7 +21,7 @@
  * @class MainCourse
  * @brief Represents a main course dish, inheriting from Dish.
  */
-class MainCourse : public Dish {
+class MainCourse : public Dish, public PoolAllocated<MainCourse> {
 public:
     /**
      * @enum CookingMethod
@@ -43,6 +44,9 @@ public:
         Category category; ///< The category of the side dish.
     };
 
+    // A main course usually comes with one or two sides, which then live inside the object
+    typedef SmallVector<SideDish, 2> SideDishList;
+
     /**
      * Default constructor.
      * Initializes all private members with default values.
@@ -61,7 +65,7 @@ public:
      * @param side_dishes The side dishes served with the main course.
      * @param gluten_free Flag indicating if the main course is gluten-free.
      */
-    MainCourse(const std::string& name, const std::vector<std::string>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, const bool &gluten_free);
+    MainCourse(const std::string& name, const std::vector<std::string>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, const std::string& protein_type, const SideDishList& side_dishes, const bool &gluten_free);
 
     /**
      * Sets the cooking method of the main course.
@@ -97,7 +101,7 @@ public:
     /**
      * @return A vector of SideDish structs representing the side dishes served with the main course.
      */
-    std::vector<SideDish> getSideDishes() const;
+    const SideDishList& getSideDishes() const;
 
     /**
      * Sets the gluten-free flag of the main course.
@@ -163,10 +167,21 @@ public:
     */
     void dietaryAccommodations(const Dish::DietaryRequest request);
 
+    /**
+     * @return A new MainCourse with the same fields, allocated from pool().
+     */
+    MainCourse* clone() const override;
+
+    /**
+     * @return Dish::dietaryProfile(), where vegetarian and vegan also need the protein to be Tofu,
+     * and gluten_free also needs every side dish to be gluten-free.
+     */
+    std::uint8_t dietaryProfile() const override;
+
 private:
     CookingMethod cooking_method_; ///< The cooking method used for the main course.
     std::string protein_type_; ///< The type of protein used in the main course.
-    std::vector<SideDish> side_dishes_; ///< The side dishes served with the main course.
+    SideDishList side_dishes_; ///< The side dishes served with the main course.
     bool gluten_free_; ///< Flag indicating if the main course is gluten-free.
 };
 
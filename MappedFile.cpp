@@ -0,0 +1,54 @@
+/**
+ * @file MappedFile.cpp
+ * @brief This file contains the implementation of the MappedFile class, a read-only memory mapping of a file.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "MappedFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filename) : data_(nullptr), size_(0), open_(false) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) == 0) {
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0) {
+            open_ = true; // mmap rejects zero-length mappings; an empty file is simply empty
+        } else {
+            void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                ::madvise(mapping, size_, MADV_SEQUENTIAL); // the loaders read front to back once
+                data_ = static_cast<const char*>(mapping);
+                open_ = true;
+            } else {
+                size_ = 0;
+            }
+        }
+    }
+    ::close(fd); // the mapping stays valid after the descriptor is closed
+}
+
+MappedFile::~MappedFile() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+bool MappedFile::isOpen() const {
+    return open_;
+}
+
+std::string_view MappedFile::contents() const {
+    return std::string_view(data_, size_);
+}
+
+std::size_t MappedFile::size() const {
+    return size_;
+}
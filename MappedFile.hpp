@@ -0,0 +1,56 @@
+/**
+ * @file MappedFile.hpp
+ * @brief This file contains the interface of the MappedFile class, a read-only memory mapping of a file.
+ *
+ * The bulk loaders walk the mapping in place instead of copying the file through a stream.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MappedFile
+ * @brief Owns a read-only, private mapping of a whole file. The mapping is released on destruction.
+ */
+class MappedFile {
+public:
+    /**
+     * Maps the named file.
+     * @param filename The file to map.
+     * @post isOpen() is true if the file could be opened and mapped. An empty file is open with size 0.
+     */
+    explicit MappedFile(const std::string& filename);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @return True if the file was opened and mapped, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * @return The contents of the file. Valid for the lifetime of this object.
+     */
+    std::string_view contents() const;
+
+    /**
+     * @return The size of the file in bytes.
+     */
+    std::size_t size() const;
+
+private:
+    const char* data_; ///< Start of the mapping, or nullptr.
+    std::size_t size_; ///< Length of the mapping in bytes.
+    bool open_;        ///< Whether the file was opened successfully.
+};
+
+#endif // MAPPEDFILE_HPP
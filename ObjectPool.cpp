@@ -0,0 +1,77 @@
+/**
+ * @file ObjectPool.cpp
+ * @brief This file contains the implementation of the ObjectPool class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "ObjectPool.hpp"
+#include <algorithm>
+#include <new>
+
+ObjectPool::ObjectPool(std::size_t slot_size, std::size_t first_block_slots)
+    : next_block_slots_(std::max<std::size_t>(first_block_slots, 1)), bump_(nullptr), bump_end_(nullptr),
+      free_list_(nullptr), live_(0), reserved_(0) {
+    // Every slot must be able to hold a free-list link and stay aligned like operator new's memory
+    const std::size_t ALIGN = alignof(std::max_align_t);
+    slot_size_ = std::max(slot_size, sizeof(FreeSlot));
+    slot_size_ = (slot_size_ + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+ObjectPool::~ObjectPool() {
+    for (char* block : blocks_) {
+        ::operator delete(block);
+    }
+}
+
+void* ObjectPool::allocate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_++;
+    if (free_list_ != nullptr) {
+        FreeSlot* slot = free_list_;
+        free_list_ = slot->next;
+        return slot;
+    }
+    if (bump_ == bump_end_) {
+        std::size_t bytes = next_block_slots_ * slot_size_;
+        char* block = static_cast<char*>(::operator new(bytes));
+        blocks_.push_back(block);
+        reserved_ += bytes;
+        bump_ = block;
+        bump_end_ = block + bytes;
+        next_block_slots_ = std::min(next_block_slots_ * 2, MAX_BLOCK_SLOTS);
+    }
+    void* slot = bump_;
+    bump_ += slot_size_;
+    return slot;
+}
+
+void ObjectPool::deallocate(void* slot) {
+    if (slot == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeSlot* freed = static_cast<FreeSlot*>(slot);
+    freed->next = free_list_;
+    free_list_ = freed;
+    live_--;
+}
+
+std::size_t ObjectPool::slotSize() const {
+    return slot_size_;
+}
+
+std::size_t ObjectPool::bytesInUse() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return live_ * slot_size_;
+}
+
+std::size_t ObjectPool::bytesReserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reserved_;
+}
+
+std::size_t ObjectPool::blockCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return blocks_.size();
+}
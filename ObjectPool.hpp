@@ -0,0 +1,132 @@
+/**
+ * @file ObjectPool.hpp
+ * @brief This file contains the interface of the ObjectPool class, a fixed-size slot allocator
+ * that carves objects out of a few large blocks.
+ *
+ * Blocks grow geometrically, so n objects cost O(log n) calls to the global allocator, and freed
+ * slots go on a free list for the next allocation instead of back to the heap.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef OBJECTPOOL_HPP
+#define OBJECTPOOL_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class ObjectPool
+ * @brief Hands out slots of one size. All member functions are safe to call from several threads.
+ */
+class ObjectPool {
+public:
+    /**
+     * Parameterized constructor.
+     * @param slot_size The size of every slot, e.g. sizeof the class the pool serves.
+     * @param first_block_slots The number of slots in the first block; each later block doubles it.
+     */
+    explicit ObjectPool(std::size_t slot_size, std::size_t first_block_slots = 64);
+
+    /**
+     * Destructor.
+     * @post All blocks are released. Slots still in use become invalid.
+     */
+    ~ObjectPool();
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /**
+     * @return Uninitialized storage for one object of at most slot_size bytes.
+     */
+    void* allocate();
+
+    /**
+     * @param slot A slot returned by allocate() whose object has been destroyed.
+     * @post The slot is reused by a later allocate().
+     */
+    void deallocate(void* slot);
+
+    /**
+     * @return The size of one slot in bytes, after rounding up for alignment.
+     */
+    std::size_t slotSize() const;
+
+    /**
+     * @return The bytes held by slots currently handed out.
+     */
+    std::size_t bytesInUse() const;
+
+    /**
+     * @return The bytes of all blocks obtained from the global allocator.
+     */
+    std::size_t bytesReserved() const;
+
+    /**
+     * @return The number of blocks obtained from the global allocator.
+     */
+    std::size_t blockCount() const;
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    static constexpr std::size_t MAX_BLOCK_SLOTS = 1 << 16;
+
+    mutable std::mutex mutex_;
+    std::size_t slot_size_;
+    std::size_t next_block_slots_;
+    std::vector<char*> blocks_;
+    char* bump_;          // Next never-used slot of the newest block
+    char* bump_end_;      // End of the newest block
+    FreeSlot* free_list_; // Slots that were handed out and given back
+    std::size_t live_;
+    std::size_t reserved_;
+};
+
+/**
+ * @class PoolAllocated
+ * @brief A base that makes `new Derived` and `delete` use one ObjectPool per Derived, e.g.
+ * `class Appetizer : public Dish, public PoolAllocated<Appetizer>`. A class derived from Derived
+ * (of another size) falls back to the global operator new.
+ */
+template <class Derived>
+class PoolAllocated {
+public:
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
+    /**
+     * @return The pool every Derived created with new is allocated from. It is never destroyed,
+     * so objects may outlive static containers that own them.
+     */
+    static ObjectPool& pool();
+};
+
+template <class Derived>
+void* PoolAllocated<Derived>::operator new(std::size_t size) {
+    if (size != sizeof(Derived)) {
+        return ::operator new(size);
+    }
+    return pool().allocate();
+}
+
+template <class Derived>
+void PoolAllocated<Derived>::operator delete(void* ptr, std::size_t size) {
+    if (size != sizeof(Derived)) {
+        ::operator delete(ptr);
+        return;
+    }
+    pool().deallocate(ptr);
+}
+
+template <class Derived>
+ObjectPool& PoolAllocated<Derived>::pool() {
+    static ObjectPool* pool = new ObjectPool(sizeof(Derived));
+    return *pool;
+}
+
+#endif // OBJECTPOOL_HPP
@@ -0,0 +1,77 @@
+/**
+ * @file RunningStats.cpp
+ * @brief This file contains the implementation of the RunningStats class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "RunningStats.hpp"
+
+void RunningStats::add(long long value) {
+    count_++;
+    sum_ += value;
+    sum_of_squares_ += value * value;
+    counts_[value]++;
+}
+
+bool RunningStats::remove(long long value) {
+    auto found = counts_.find(value);
+    if (found == counts_.end()) {
+        return false;
+    }
+    if (--found->second == 0) {
+        counts_.erase(found);
+    }
+    count_--;
+    sum_ -= value;
+    sum_of_squares_ -= value * value;
+    return true;
+}
+
+void RunningStats::clear() {
+    count_ = 0;
+    sum_ = 0;
+    sum_of_squares_ = 0;
+    counts_.clear();
+}
+
+long long RunningStats::count() const {
+    return count_;
+}
+
+long long RunningStats::sum() const {
+    return sum_;
+}
+
+long long RunningStats::min() const {
+    return counts_.empty() ? 0 : counts_.begin()->first;
+}
+
+long long RunningStats::max() const {
+    return counts_.empty() ? 0 : counts_.rbegin()->first;
+}
+
+double RunningStats::mean() const {
+    return count_ == 0 ? 0.0 : double(sum_) / count_;
+}
+
+double RunningStats::variance() const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    // (n * sum(x^2) - sum(x)^2) / n^2, in long double so the products do not overflow
+    long double n = count_;
+    long double spread = n * sum_of_squares_ - (long double) sum_ * sum_;
+    return spread < 0 ? 0.0 : double(spread / (n * n));
+}
+
+RunningStats::Summary RunningStats::summary(double scale) const {
+    Summary summary;
+    summary.count = count_;
+    summary.sum = sum_ / scale;
+    summary.min = min() / scale;
+    summary.max = max() / scale;
+    summary.mean = mean() / scale;
+    summary.variance = variance() / (scale * scale);
+    return summary;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file RunningStats.hpp
+ * @brief This file contains the interface of the RunningStats class, exact running statistics over
+ * a multiset of integer values that supports removals.
+ *
+ * The sum and the sum of squares are kept as integers, so they are exact however many values come
+ * and go, and a counted map of the distinct values keeps the minimum and maximum correct when the
+ * current extreme is removed.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef RUNNINGSTATS_HPP
+#define RUNNINGSTATS_HPP
+
+#include <map>
+
+/**
+ * @class RunningStats
+ * @brief Count, sum, minimum, maximum, mean and variance of the values currently held.
+ * Adding and removing a value is O(log d) for d distinct values; every query is O(1).
+ */
+class RunningStats {
+public:
+    /**
+     * @struct Summary
+     * @brief A copy of every statistic at one point in time, in the units the caller chose.
+     * All fields are 0 when there are no values.
+     */
+    struct Summary {
+        long long count = 0;
+        double sum = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        double mean = 0.0;
+        double variance = 0.0; // Population variance
+    };
+
+    /**
+     * @post value is one more of the values held.
+     */
+    void add(long long value);
+
+    /**
+     * @return True if value was held and one copy of it has been removed, false otherwise.
+     */
+    bool remove(long long value);
+
+    /**
+     * @post No values are held.
+     */
+    void clear();
+
+    long long count() const;
+    long long sum() const;
+
+    /**
+     * @return The smallest value held, or 0 if there are none.
+     */
+    long long min() const;
+
+    /**
+     * @return The largest value held, or 0 if there are none.
+     */
+    long long max() const;
+
+    /**
+     * @return sum() / count(), or 0 if there are no values.
+     */
+    double mean() const;
+
+    /**
+     * @return The population variance of the values held, or 0 if there are none.
+     */
+    double variance() const;
+
+    /**
+     * @param scale The values are divided by scale in the summary (the variance by scale squared),
+     * e.g. 100 for values kept in cents and reported in dollars.
+     * @return Every statistic at once.
+     */
+    Summary summary(double scale = 1.0) const;
+
+private:
+    long long count_ = 0;
+    long long sum_ = 0;
+    long long sum_of_squares_ = 0;
+    std::map<long long, long long> counts_; // Distinct value -> how many times it is held
+};
+
+#endif // RUNNINGSTATS_HPP
@@ -0,0 +1,177 @@
+/**
+ * @file ShardedKitchen.cpp
+ * @brief This file contains the implementation of the ShardedKitchen class.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "ShardedKitchen.hpp"
+#include <cmath>
+#include <functional>
+#include <iostream>
+
+void ShardedKitchen::Totals::merge(const Totals& other)
+{
+    dishes += other.dishes;
+    prep_time_sum += other.prep_time_sum;
+    elaborate += other.elaborate;
+    for (size_t i = 0; i < cuisine_counts.size(); i++)
+    {
+        cuisine_counts[i] += other.cuisine_counts[i];
+    }
+}
+
+int ShardedKitchen::Totals::averagePrepTime() const
+{
+    if (dishes == 0)
+    {
+        return 0;
+    }
+    return round(double(prep_time_sum) / dishes);
+}
+
+double ShardedKitchen::Totals::elaboratePercentage() const
+{
+    if (dishes == 0 || elaborate == 0)
+    {
+        return 0;
+    }
+    return round(double(elaborate) / double(dishes) * 10000) / 100;
+}
+
+ShardedKitchen::ShardedKitchen(unsigned shards, Partition partition)
+    : shard_count_(shards == 0 ? 1 : shards), partition_(partition)
+{
+    shards_.reset(new Shard[shard_count_]);
+}
+
+unsigned ShardedKitchen::shardFor(const Dish* dish) const
+{
+    if (partition_ == BY_CUISINE)
+    {
+        return static_cast<unsigned>(dish->getCuisineTypeEnum()) % shard_count_;
+    }
+    return std::hash<std::string>()(dish->getName()) % shard_count_;
+}
+
+bool ShardedKitchen::newOrder(Dish* new_dish)
+{
+    Shard& shard = shards_[shardFor(new_dish)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.kitchen.newOrder(new_dish);
+}
+
+bool ShardedKitchen::serveDish(Dish* dish_to_remove)
+{
+    Shard& shard = shards_[shardFor(dish_to_remove)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.kitchen.serveDish(dish_to_remove);
+}
+
+ShardedKitchen::Totals ShardedKitchen::getShardTotals(unsigned shard) const
+{
+    const Shard& s = shards_[shard];
+    std::lock_guard<std::mutex> lock(s.mutex);
+    Totals totals;
+    totals.dishes = s.kitchen.getCurrentSize();
+    totals.prep_time_sum = s.kitchen.getPrepTimeSum();
+    totals.elaborate = s.kitchen.elaborateDishCount();
+    for (size_t i = 0; i < totals.cuisine_counts.size(); i++)
+    {
+        totals.cuisine_counts[i] = s.kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(i));
+    }
+    return totals;
+}
+
+ShardedKitchen::Totals ShardedKitchen::getTotals() const
+{
+    Totals totals;
+    for (unsigned s = 0; s < shard_count_; s++)
+    {
+        totals.merge(getShardTotals(s));
+    }
+    return totals;
+}
+
+unsigned ShardedKitchen::getShardCount() const
+{
+    return shard_count_;
+}
+
+int ShardedKitchen::getCurrentSize() const
+{
+    int count = 0;
+    for (unsigned s = 0; s < shard_count_; s++)
+    {
+        std::lock_guard<std::mutex> lock(shards_[s].mutex);
+        count += shards_[s].kitchen.getCurrentSize();
+    }
+    return count;
+}
+
+int ShardedKitchen::getPrepTimeSum() const
+{
+    int sum = 0;
+    for (unsigned s = 0; s < shard_count_; s++)
+    {
+        std::lock_guard<std::mutex> lock(shards_[s].mutex);
+        sum += shards_[s].kitchen.getPrepTimeSum();
+    }
+    return sum;
+}
+
+int ShardedKitchen::calculateAvgPrepTime() const
+{
+    return getTotals().averagePrepTime();
+}
+
+int ShardedKitchen::elaborateDishCount() const
+{
+    int count = 0;
+    for (unsigned s = 0; s < shard_count_; s++)
+    {
+        std::lock_guard<std::mutex> lock(shards_[s].mutex);
+        count += shards_[s].kitchen.elaborateDishCount();
+    }
+    return count;
+}
+
+double ShardedKitchen::calculateElaboratePercentage() const
+{
+    return getTotals().elaboratePercentage();
+}
+
+int ShardedKitchen::tallyCuisineTypes(const std::string& cuisine_type) const
+{
+    int type = CUISINE_TYPE_TABLE.find(cuisine_type);
+    if (type < 0)
+    {
+        return 0;
+    }
+    if (partition_ == BY_CUISINE)
+    {
+        // Only one shard can hold dishes of this cuisine
+        const Shard& shard = shards_[type % shard_count_];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(type));
+    }
+    int count = 0;
+    for (unsigned s = 0; s < shard_count_; s++)
+    {
+        std::lock_guard<std::mutex> lock(shards_[s].mutex);
+        count += shards_[s].kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(type));
+    }
+    return count;
+}
+
+void ShardedKitchen::kitchenReport() const
+{
+    Totals totals = getTotals();
+    for (size_t i = 0; i < totals.cuisine_counts.size(); i++)
+    {
+        std::cout << CUISINE_TYPE_TABLE.names[i] << ": " << totals.cuisine_counts[i] << std::endl;
+    }
+    std::cout << std::endl;
+    std::cout << "AVERAGE PREP TIME: " << totals.averagePrepTime() << std::endl;
+    std::cout << "ELABORATE DISHES: " << totals.elaboratePercentage() << "%" << std::endl;
+}
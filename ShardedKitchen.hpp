@@ -0,0 +1,115 @@
+/**
+ * @file ShardedKitchen.hpp
+ * @brief This file contains the interface of the ShardedKitchen class, which spreads dishes over
+ * N independent Kitchen shards.
+ *
+ * Dishes are partitioned by cuisine type or by a hash of their name. Each shard has its own lock
+ * and keeps its own running totals, so orders for different shards proceed in parallel and the
+ * reports are computed by merging per-shard partial aggregates.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef SHARDEDKITCHEN_HPP
+#define SHARDEDKITCHEN_HPP
+
+#include "Kitchen.hpp"
+#include "EnumTables.hpp"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+
+class ShardedKitchen {
+    public:
+        /**
+        * How a dish picks its shard.
+        * BY_CUISINE sends every dish of a cuisine type to the same shard (cuisine % shards).
+        * BY_NAME_HASH spreads dishes evenly by a hash of their name.
+        */
+        enum Partition { BY_CUISINE, BY_NAME_HASH };
+
+        /**
+        * Partial aggregate of one or more shards. Merging partials gives the kitchen-wide values.
+        */
+        struct Totals {
+            int dishes = 0;
+            int prep_time_sum = 0;
+            int elaborate = 0;
+            std::array<int, CUISINE_TYPE_TABLE.names.size()> cuisine_counts{};
+
+            /**
+            * @post Adds the counts of other into this aggregate.
+            */
+            void merge(const Totals& other);
+
+            /**
+            * @return The average preparation time, rounded to the nearest integer (0 if there are no dishes).
+            */
+            int averagePrepTime() const;
+
+            /**
+            * @return The percentage of elaborate dishes, rounded to 2 decimal places (0 if there are none).
+            */
+            double elaboratePercentage() const;
+        };
+
+        /**
+        * Parameterized constructor.
+        * @param shards The number of shards, at least 1.
+        * @param partition How dishes are assigned to shards.
+        */
+        explicit ShardedKitchen(unsigned shards, Partition partition = BY_CUISINE);
+
+        ShardedKitchen(const ShardedKitchen&) = delete;
+        ShardedKitchen& operator=(const ShardedKitchen&) = delete;
+
+        /**
+        * Adds a dish to its shard. Safe to call from several threads.
+        * @return True if the dish was added, false otherwise.
+        */
+        bool newOrder(Dish* new_dish);
+
+        /**
+        * Removes a dish from its shard. Safe to call from several threads.
+        * @return True if the dish was removed, false otherwise.
+        */
+        bool serveDish(Dish* dish_to_remove);
+
+        /**
+        * @return The merged totals of all shards, each shard read under its own lock.
+        */
+        Totals getTotals() const;
+
+        /**
+        * @return The totals of one shard.
+        */
+        Totals getShardTotals(unsigned shard) const;
+
+        unsigned getShardCount() const;
+        int getCurrentSize() const;
+        int getPrepTimeSum() const;
+        int calculateAvgPrepTime() const;
+        int elaborateDishCount() const;
+        double calculateElaboratePercentage() const;
+        int tallyCuisineTypes(const std::string& cuisine_type) const;
+
+        /**
+        * Prints the same report as Kitchen::kitchenReport(), from the merged shard totals.
+        */
+        void kitchenReport() const;
+
+    private:
+        struct alignas(64) Shard {
+            mutable std::mutex mutex;
+            Kitchen kitchen;
+        };
+
+        std::unique_ptr<Shard[]> shards_;
+        unsigned shard_count_;
+        Partition partition_;
+
+        unsigned shardFor(const Dish* dish) const;
+};
+
+#endif // SHARDEDKITCHEN_HPP
@@ -0,0 +1,322 @@
+/*
+SmallVector implementation
+*/
+
+#include "SmallVector.hpp"
+#include <new>
+#include <utility>
+
+/** default constructor**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>::SmallVector(): items_(inlineItems()), item_count_(0), capacity_(N)
+{
+}  // end default constructor
+
+/** constructs from a list of items**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>::SmallVector(std::initializer_list<ItemType> items): SmallVector()
+{
+   reserve(items.size());
+   for (const ItemType& item : items)
+   {
+      push_back(item);
+   }  // end for
+}  // end initializer_list constructor
+
+/** constructs from the items of a std::vector**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>::SmallVector(const std::vector<ItemType>& items): SmallVector()
+{
+   reserve(items.size());
+   for (const ItemType& item : items)
+   {
+      push_back(item);
+   }  // end for
+}  // end std::vector constructor
+
+/** copy constructor**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>::SmallVector(const SmallVector<ItemType, N>& other): SmallVector()
+{
+   reserve(other.item_count_);
+   for (const ItemType& item : other)
+   {
+      push_back(item);
+   }  // end for
+}  // end copy constructor
+
+/** move constructor**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>::SmallVector(SmallVector<ItemType, N>&& other) noexcept: SmallVector()
+{
+   *this = std::move(other);
+}  // end move constructor
+
+/** copy assignment**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>& SmallVector<ItemType, N>::operator=(const SmallVector<ItemType, N>& other)
+{
+   if (this != &other)
+   {
+      clear();
+      reserve(other.item_count_);
+      for (const ItemType& item : other)
+      {
+         push_back(item);
+      }  // end for
+   }  // end if
+   return *this;
+}  // end operator=
+
+/** move assignment**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>& SmallVector<ItemType, N>::operator=(SmallVector<ItemType, N>&& other) noexcept
+{
+   if (this != &other)
+   {
+      reset();
+      if (other.isInline())
+      {
+         // Inline items live inside other, so they have to be moved one at a time
+         for (std::size_t i = 0; i < other.item_count_; i++)
+         {
+            new (items_ + i) ItemType(std::move(other.items_[i]));
+         }  // end for
+         item_count_ = other.item_count_;
+         other.clear();
+      }
+      else
+      {
+         items_ = other.items_;
+         item_count_ = other.item_count_;
+         capacity_ = other.capacity_;
+         other.items_ = other.inlineItems();
+         other.item_count_ = 0;
+         other.capacity_ = N;
+      }  // end if
+   }  // end if
+   return *this;
+}  // end move assignment
+
+/** destructor**/
+template<class ItemType, std::size_t N>
+SmallVector<ItemType, N>::~SmallVector()
+{
+   reset();
+}  // end destructor
+
+template<class ItemType, std::size_t N>
+std::size_t SmallVector<ItemType, N>::size() const
+{
+   return item_count_;
+}  // end size
+
+template<class ItemType, std::size_t N>
+bool SmallVector<ItemType, N>::empty() const
+{
+   return item_count_ == 0;
+}  // end empty
+
+template<class ItemType, std::size_t N>
+std::size_t SmallVector<ItemType, N>::capacity() const
+{
+   return capacity_;
+}  // end capacity
+
+template<class ItemType, std::size_t N>
+bool SmallVector<ItemType, N>::isInline() const
+{
+   return items_ == reinterpret_cast<const ItemType*>(inline_);
+}  // end isInline
+
+template<class ItemType, std::size_t N>
+ItemType& SmallVector<ItemType, N>::operator[](std::size_t i)
+{
+   return items_[i];
+}  // end operator[]
+
+template<class ItemType, std::size_t N>
+const ItemType& SmallVector<ItemType, N>::operator[](std::size_t i) const
+{
+   return items_[i];
+}  // end operator[]
+
+template<class ItemType, std::size_t N>
+ItemType& SmallVector<ItemType, N>::back()
+{
+   return items_[item_count_ - 1];
+}  // end back
+
+template<class ItemType, std::size_t N>
+const ItemType& SmallVector<ItemType, N>::back() const
+{
+   return items_[item_count_ - 1];
+}  // end back
+
+template<class ItemType, std::size_t N>
+typename SmallVector<ItemType, N>::iterator SmallVector<ItemType, N>::begin()
+{
+   return items_;
+}  // end begin
+
+template<class ItemType, std::size_t N>
+typename SmallVector<ItemType, N>::const_iterator SmallVector<ItemType, N>::begin() const
+{
+   return items_;
+}  // end begin
+
+template<class ItemType, std::size_t N>
+typename SmallVector<ItemType, N>::iterator SmallVector<ItemType, N>::end()
+{
+   return items_ + item_count_;
+}  // end end
+
+template<class ItemType, std::size_t N>
+typename SmallVector<ItemType, N>::const_iterator SmallVector<ItemType, N>::end() const
+{
+   return items_ + item_count_;
+}  // end end
+
+/**
+ @post new_entry has been appended
+ **/
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::push_back(const ItemType& new_entry)
+{
+   if (item_count_ == capacity_)
+   {
+      ItemType copy(new_entry); // new_entry may be one of our own items, which reallocate moves
+      push_back(std::move(copy));
+      return;
+   }  // end if
+   new (items_ + item_count_) ItemType(new_entry);
+   item_count_++;
+}  // end push_back
+
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::push_back(ItemType&& new_entry)
+{
+   if (item_count_ == capacity_)
+   {
+      reallocate(capacity_ * 2);
+   }  // end if
+   new (items_ + item_count_) ItemType(std::move(new_entry));
+   item_count_++;
+}  // end push_back
+
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::pop_back()
+{
+   item_count_--;
+   items_[item_count_].~ItemType();
+}  // end pop_back
+
+/**
+ @return an iterator to the item that followed the erased one
+ **/
+template<class ItemType, std::size_t N>
+typename SmallVector<ItemType, N>::iterator SmallVector<ItemType, N>::erase(iterator position)
+{
+   for (iterator next = position + 1; next != end(); ++next)
+   {
+      *(next - 1) = std::move(*next);
+   }  // end for
+   pop_back();
+   return position;
+}  // end erase
+
+/**
+ @post size() == 0
+ **/
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::clear()
+{
+   while (item_count_ > 0)
+   {
+      pop_back();
+   }  // end while
+}  // end clear
+
+/**
+ @post capacity() >= new_capacity
+ **/
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::reserve(std::size_t new_capacity)
+{
+   if (new_capacity > capacity_)
+   {
+      reallocate(new_capacity);
+   }  // end if
+}  // end reserve
+
+template<class ItemType, std::size_t N>
+bool SmallVector<ItemType, N>::operator==(const SmallVector<ItemType, N>& other) const
+{
+   if (item_count_ != other.item_count_)
+   {
+      return false;
+   }  // end if
+   for (std::size_t i = 0; i < item_count_; i++)
+   {
+      if (!(items_[i] == other.items_[i]))
+      {
+         return false;
+      }  // end if
+   }  // end for
+   return true;
+}  // end operator==
+
+template<class ItemType, std::size_t N>
+bool SmallVector<ItemType, N>::operator!=(const SmallVector<ItemType, N>& other) const
+{
+   return !(*this == other);
+}  // end operator!=
+
+template<class ItemType, std::size_t N>
+std::vector<ItemType> SmallVector<ItemType, N>::toVector() const
+{
+   return std::vector<ItemType>(begin(), end());
+}  // end toVector
+
+// ********* PRIVATE METHODS **************//
+
+template<class ItemType, std::size_t N>
+ItemType* SmallVector<ItemType, N>::inlineItems()
+{
+   return reinterpret_cast<ItemType*>(inline_);
+}  // end inlineItems
+
+/**
+ @post items_ points to a heap buffer of new_capacity items holding the old items
+ **/
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::reallocate(std::size_t new_capacity)
+{
+   ItemType* new_items = static_cast<ItemType*>(::operator new(new_capacity * sizeof(ItemType)));
+   for (std::size_t i = 0; i < item_count_; i++)
+   {
+      new (new_items + i) ItemType(std::move(items_[i]));
+      items_[i].~ItemType();
+   }  // end for
+   if (!isInline())
+   {
+      ::operator delete(items_);
+   }  // end if
+   items_ = new_items;
+   capacity_ = new_capacity;
+}  // end reallocate
+
+/**
+ @post the vector is empty and back on its inline buffer
+ **/
+template<class ItemType, std::size_t N>
+void SmallVector<ItemType, N>::reset()
+{
+   clear();
+   if (!isInline())
+   {
+      ::operator delete(items_);
+      items_ = inlineItems();
+      capacity_ = N;
+   }  // end if
+}  // end reset
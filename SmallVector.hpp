@@ -0,0 +1,140 @@
+/*
+SmallVector interface
+A vector that keeps up to N items inside the object itself and only allocates once it grows past N.
+It has the subset of the std::vector interface the dish classes use, so it can stand in for one.
+*/
+
+#ifndef SMALL_VECTOR_
+#define SMALL_VECTOR_
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+template <class ItemType, std::size_t N>
+class SmallVector
+{
+   static_assert(N > 0, "SmallVector needs room for at least one inline item");
+
+   public:
+   typedef ItemType value_type;
+   typedef ItemType *iterator;
+   typedef const ItemType *const_iterator;
+
+   /** default constructor, uses the inline buffer**/
+   SmallVector();
+
+   /** constructs from a list of items**/
+   SmallVector(std::initializer_list<ItemType> items);
+
+   /** constructs from the items of a std::vector**/
+   SmallVector(const std::vector<ItemType> &items);
+
+   /** copy constructor**/
+   SmallVector(const SmallVector<ItemType, N> &other);
+
+   /** move constructor, steals a heap buffer and moves inline items one by one**/
+   SmallVector(SmallVector<ItemType, N> &&other) noexcept;
+
+   /** copy assignment**/
+   SmallVector<ItemType, N> &operator=(const SmallVector<ItemType, N> &other);
+
+   /** move assignment**/
+   SmallVector<ItemType, N> &operator=(SmallVector<ItemType, N> &&other) noexcept;
+
+   /** destructor, destroys the items and releases a heap buffer if there is one**/
+   ~SmallVector();
+
+   /**
+       @return the number of items
+   **/
+   std::size_t size() const;
+
+   /**
+       @return true if there are no items
+   **/
+   bool empty() const;
+
+   /**
+       @return the number of items the vector can hold before it reallocates (at least N)
+   **/
+   std::size_t capacity() const;
+
+   /**
+       @return true if the items are stored inside the object rather than on the heap
+   **/
+   bool isInline() const;
+
+   ItemType &operator[](std::size_t i);
+   const ItemType &operator[](std::size_t i) const;
+   ItemType &back();
+   const ItemType &back() const;
+
+   iterator begin();
+   const_iterator begin() const;
+   iterator end();
+   const_iterator end() const;
+
+   /**
+       @post new_entry has been appended; if the buffer was full the items moved to one twice as large
+   **/
+   void push_back(const ItemType &new_entry);
+   void push_back(ItemType &&new_entry);
+
+   /**
+       @post the last item has been destroyed
+   **/
+   void pop_back();
+
+   /**
+       @param position an iterator to an item
+       @return an iterator to the item that followed the erased one
+       @post the items after position have moved back by one
+   **/
+   iterator erase(iterator position);
+
+   /**
+       @post size() == 0, the capacity is unchanged
+   **/
+   void clear();
+
+   /**
+       @post capacity() >= new_capacity
+   **/
+   void reserve(std::size_t new_capacity);
+
+   /**
+       @return true if both vectors hold equal items in the same order
+   **/
+   bool operator==(const SmallVector<ItemType, N> &other) const;
+   bool operator!=(const SmallVector<ItemType, N> &other) const;
+
+   /**
+       @return a std::vector with copies of the items
+   **/
+   std::vector<ItemType> toVector() const;
+
+   private:
+   alignas(ItemType) unsigned char inline_[N * sizeof(ItemType)]; // Storage for the first N items
+   ItemType *items_;                                              // inline_ or a heap buffer
+   std::size_t item_count_;
+   std::size_t capacity_;
+
+   /**
+       @return the inline buffer as an array of items
+   **/
+   ItemType *inlineItems();
+
+   /**
+       @post items_ points to a heap buffer of new_capacity items holding the old items
+   **/
+   void reallocate(std::size_t new_capacity);
+
+   /**
+       @post the items are destroyed and a heap buffer is released; the vector is empty and inline
+   **/
+   void reset();
+
+}; // end SmallVector
+
+#include "SmallVector.cpp"
+#endif
@@ -0,0 +1,104 @@
+/**
+ * @file Snapshot.cpp
+ * @brief This file contains the implementation of the SnapshotWriter and SnapshotReader classes.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "Snapshot.hpp"
+#include <cstring>
+#include <fstream>
+
+void SnapshotWriter::putU8(std::uint8_t value) {
+    buffer_.push_back(static_cast<char>(value));
+}
+
+void SnapshotWriter::putU32(std::uint32_t value) {
+    buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void SnapshotWriter::putI32(std::int32_t value) {
+    buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void SnapshotWriter::putF64(double value) {
+    buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void SnapshotWriter::putString(std::string_view value) {
+    putU32(static_cast<std::uint32_t>(value.size()));
+    buffer_.append(value.data(), value.size());
+}
+
+void SnapshotWriter::putBytes(std::string_view bytes) {
+    buffer_.append(bytes.data(), bytes.size());
+}
+
+bool SnapshotWriter::writeTo(const std::string& filename) const {
+    std::ofstream f(filename, std::ios::binary | std::ios::trunc);
+    if (!f.is_open()) {
+        return false;
+    }
+    f.write(buffer_.data(), buffer_.size());
+    return static_cast<bool>(f);
+}
+
+SnapshotReader::SnapshotReader(std::string_view data) : data_(data), pos_(0), ok_(true) {
+}
+
+bool SnapshotReader::take(void* out, std::size_t count) {
+    if (!ok_ || data_.size() - pos_ < count) {
+        ok_ = false;
+        std::memset(out, 0, count);
+        return false;
+    }
+    std::memcpy(out, data_.data() + pos_, count);
+    pos_ += count;
+    return true;
+}
+
+std::uint8_t SnapshotReader::getU8() {
+    std::uint8_t value;
+    take(&value, sizeof(value));
+    return value;
+}
+
+std::uint32_t SnapshotReader::getU32() {
+    std::uint32_t value;
+    take(&value, sizeof(value));
+    return value;
+}
+
+std::int32_t SnapshotReader::getI32() {
+    std::int32_t value;
+    take(&value, sizeof(value));
+    return value;
+}
+
+double SnapshotReader::getF64() {
+    double value;
+    take(&value, sizeof(value));
+    return value;
+}
+
+std::string_view SnapshotReader::getString() {
+    return getBytes(getU32());
+}
+
+std::string_view SnapshotReader::getBytes(std::size_t count) {
+    if (!ok_ || data_.size() - pos_ < count) {
+        ok_ = false;
+        return std::string_view();
+    }
+    std::string_view bytes = data_.substr(pos_, count);
+    pos_ += count;
+    return bytes;
+}
+
+bool SnapshotReader::ok() const {
+    return ok_;
+}
+
+std::size_t SnapshotReader::remaining() const {
+    return data_.size() - pos_;
+}
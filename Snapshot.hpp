@@ -0,0 +1,95 @@
+/**
+ * @file Snapshot.hpp
+ * @brief This file contains the interface of the SnapshotWriter and SnapshotReader classes,
+ * the byte-level encoding of Kitchen snapshot files.
+ *
+ * A snapshot is a flat buffer of fixed-width integers (host byte order), IEEE doubles and
+ * length-prefixed strings. The Kitchen decides what goes into it; these classes only encode values.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @class SnapshotWriter
+ * @brief Appends encoded values to an in-memory buffer that is written out in one call.
+ */
+class SnapshotWriter {
+public:
+    void putU8(std::uint8_t value);
+    void putU32(std::uint32_t value);
+    void putI32(std::int32_t value);
+    void putF64(double value);
+
+    /**
+     * Appends a u32 byte length followed by the bytes of the string.
+     */
+    void putString(std::string_view value);
+
+    /**
+     * Appends raw bytes with no length prefix.
+     */
+    void putBytes(std::string_view bytes);
+
+    /**
+     * Writes the buffer to a file, replacing it.
+     * @return True if the whole buffer was written, false otherwise.
+     */
+    bool writeTo(const std::string& filename) const;
+
+private:
+    std::string buffer_;
+};
+
+/**
+ * @class SnapshotReader
+ * @brief Decodes values from the front of a buffer, failing instead of reading past its end.
+ * Once a read fails, every later read fails too, so a record can be decoded first and checked once.
+ */
+class SnapshotReader {
+public:
+    /**
+     * @param data The encoded bytes. Must outlive the reader and any string_view it returns.
+     */
+    explicit SnapshotReader(std::string_view data);
+
+    std::uint8_t getU8();
+    std::uint32_t getU32();
+    std::int32_t getI32();
+    double getF64();
+
+    /**
+     * @return A view of a length-prefixed string inside the buffer.
+     */
+    std::string_view getString();
+
+    /**
+     * @return A view of the next count raw bytes inside the buffer.
+     */
+    std::string_view getBytes(std::size_t count);
+
+    /**
+     * @return True if no read has run past the end of the buffer.
+     */
+    bool ok() const;
+
+    /**
+     * @return The number of bytes that have not been read yet.
+     */
+    std::size_t remaining() const;
+
+private:
+    std::string_view data_;
+    std::size_t pos_;
+    bool ok_;
+
+    bool take(void* out, std::size_t count);
+};
+
+#endif // SNAPSHOT_HPP
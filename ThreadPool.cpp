@@ -0,0 +1,113 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief This file contains the implementation of the ThreadPool class, a fixed set of reusable worker threads.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#include "ThreadPool.hpp"
+
+namespace {
+
+// The pool whose batch this thread is running a task of, or nullptr
+thread_local const ThreadPool* batch_pool = nullptr;
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+    for (unsigned i = 1; i < threads; ++i) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+unsigned ThreadPool::size() const {
+    return static_cast<unsigned>(workers_.size()) + 1;
+}
+
+void ThreadPool::run(std::size_t tasks, const std::function<void(std::size_t)>& task) {
+    if (tasks == 0) {
+        return;
+    }
+    // A task of this pool's batch holds up the batch, and its caller holds submit_mutex_, so a
+    // nested batch could never start; it runs on the calling thread instead
+    if (workers_.empty() || tasks == 1 || batch_pool == this) {
+        for (std::size_t i = 0; i < tasks; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(submit_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = tasks;
+        next_task_.store(0);
+        workers_busy_ = workers_.size();
+        generation_++;
+    }
+    work_ready_.notify_all();
+
+    drain(task, tasks);
+
+    // The batch is over once every worker has run out of tasks and checked back in
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_done_.wait(lock, [this] { return workers_busy_ == 0; });
+    task_ = nullptr;
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::workerLoop() {
+    unsigned long seen = 0;
+    while (true) {
+        const std::function<void(std::size_t)>* task;
+        std::size_t tasks;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_ready_.wait(lock, [this, seen] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+            task = task_;
+            tasks = task_count_;
+        }
+
+        drain(*task, tasks);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--workers_busy_ == 0) {
+            work_done_.notify_one();
+        }
+    }
+}
+
+void ThreadPool::drain(const std::function<void(std::size_t)>& task, std::size_t tasks) {
+    const ThreadPool* outer = batch_pool;
+    batch_pool = this;
+    for (std::size_t i = next_task_.fetch_add(1); i < tasks; i = next_task_.fetch_add(1)) {
+        task(i);
+    }
+    batch_pool = outer;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief This file contains the interface of the ThreadPool class, a fixed set of reusable worker threads.
+ *
+ * Work is submitted as a batch of numbered tasks; the calling thread helps run the batch and
+ * returns once every task has finished.
+ *
+ * @author Saveliy Mizerovskiy
+ */
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Runs batches of independent tasks on a fixed set of worker threads.
+ */
+class ThreadPool {
+public:
+    /**
+     * Parameterized constructor.
+     * @param threads The number of threads that run a batch, counting the caller.
+     * 0 means one per hardware thread.
+     * @post threads - 1 worker threads are started and wait for work.
+     */
+    explicit ThreadPool(unsigned threads = 0);
+
+    /**
+     * Destructor.
+     * @post All worker threads are stopped and joined.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @return The number of threads that run a batch, counting the caller.
+     */
+    unsigned size() const;
+
+    /**
+     * Runs task(0), task(1), ..., task(tasks - 1), each exactly once, spread over the pool.
+     * @param tasks The number of tasks in the batch.
+     * @param task The function to run for each task index. Tasks must be independent.
+     * @post Every task has finished. Batches submitted from several threads run one after another.
+     * A task that calls run() on the same pool, e.g. a parallel load inside a parallel dietary
+     * adjustment, runs the nested batch on its own thread instead of waiting for the pool.
+     */
+    void run(std::size_t tasks, const std::function<void(std::size_t)>& task);
+
+    /**
+     * @return A process-wide pool with one thread per hardware thread, created on first use.
+     */
+    static ThreadPool& shared();
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex submit_mutex_;                 ///< Serializes calls to run().
+    std::mutex mutex_;                        ///< Guards the fields below.
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    const std::function<void(std::size_t)>* task_ = nullptr;
+    std::size_t task_count_ = 0;
+    std::atomic<std::size_t> next_task_{0};
+    std::size_t workers_busy_ = 0;
+    unsigned long generation_ = 0;            ///< Bumped for every batch so workers join it once.
+    bool stopping_ = false;
+
+    void workerLoop();
+    void drain(const std::function<void(std::size_t)>& task, std::size_t tasks);
+};
+
+#endif // THREADPOOL_HPP